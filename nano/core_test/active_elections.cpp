@@ -1295,6 +1295,60 @@ TEST (active_elections, list_active)
 	auto active = node.active.list_active ();
 }
 
+// Elections spread over all shards are listed in insertion order and counted consistently
+TEST (active_elections, list_active_sharded)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.backlog_population.enable = false;
+	auto & node = *system.add_node (config);
+
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	auto latest = nano::dev::genesis->hash ();
+	auto balance = nano::dev::constants.genesis_amount;
+	nano::state_block_builder builder;
+	for (int i = 0; i < 32; ++i)
+	{
+		nano::keypair key;
+		balance -= 1;
+		auto send = builder.make_block ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (latest)
+					.representative (nano::dev::genesis_key.pub)
+					.link (key.pub)
+					.balance (balance)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*system.work.generate (latest))
+					.build ();
+		ASSERT_EQ (nano::block_status::progress, node.process (send));
+		latest = send->hash ();
+		blocks.push_back (send);
+	}
+
+	// Elections are started one at a time, so the insertion order is the order of blocks
+	ASSERT_TRUE (nano::test::start_elections (system, node, blocks));
+	ASSERT_EQ (blocks.size (), node.active.size ());
+	ASSERT_EQ (blocks.size (), node.active.size (nano::election_behavior::manual));
+
+	auto all = node.active.list_active ();
+	ASSERT_EQ (blocks.size (), all.size ());
+	for (std::size_t i = 0; i < blocks.size (); ++i)
+	{
+		ASSERT_EQ (blocks[i]->qualified_root (), all[i]->qualified_root);
+	}
+	auto first = node.active.list_active (5);
+	ASSERT_EQ (5, first.size ());
+	ASSERT_TRUE (std::equal (first.begin (), first.end (), all.begin ()));
+
+	for (auto const & block : blocks)
+	{
+		ASSERT_TRUE (node.active.erase (*block));
+	}
+	ASSERT_TRUE (node.active.empty ());
+	ASSERT_EQ (0, node.active.size (nano::election_behavior::manual));
+	ASSERT_TRUE (node.active.list_active ().empty ());
+}
+
 TEST (active_elections, vacancy)
 {
 	std::atomic<bool> updated = false;
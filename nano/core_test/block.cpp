@@ -28,6 +28,80 @@ TEST (ed25519, signing)
 	ASSERT_NE (0, valid2);
 }
 
+TEST (ed25519, batch)
+{
+	size_t const count = 70; // More than a single internal batch of 64
+	std::vector<nano::keypair> keys (count);
+	std::vector<nano::uint256_union> messages (count);
+	std::vector<nano::signature> signatures (count);
+	std::vector<unsigned char const *> messages_l;
+	std::vector<size_t> lengths;
+	std::vector<unsigned char const *> public_keys;
+	std::vector<unsigned char const *> signatures_l;
+	for (size_t i = 0; i < count; ++i)
+	{
+		messages[i] = nano::uint256_union (i);
+		signatures[i] = nano::sign_message (keys[i].prv, keys[i].pub, messages[i]);
+		messages_l.push_back (messages[i].bytes.data ());
+		lengths.push_back (sizeof (messages[i].bytes));
+		public_keys.push_back (keys[i].pub.bytes.data ());
+		signatures_l.push_back (signatures[i].bytes.data ());
+	}
+	std::vector<int> valid (count, 0);
+	ASSERT_FALSE (nano::validate_message_batch (messages_l.data (), lengths.data (), public_keys.data (), signatures_l.data (), count, valid.data ()));
+	ASSERT_TRUE (std::all_of (valid.begin (), valid.end (), [] (int value) { return value == 1; }));
+
+	// A single corrupted signature fails the batch, only that signature is reported invalid
+	signatures[5].bytes[32] ^= 0x1;
+	ASSERT_TRUE (nano::validate_message_batch (messages_l.data (), lengths.data (), public_keys.data (), signatures_l.data (), count, valid.data ()));
+	for (size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ (i == 5 ? 0 : 1, valid[i]);
+	}
+}
+
+// Adding a multiple of the group order to S does not change the reduced scalar, batch verification has to reject such signatures like single verification does
+TEST (ed25519, batch_non_canonical)
+{
+	size_t const count = 8; // Batch verification is only used for 4 or more signatures
+	std::vector<nano::keypair> keys (count);
+	std::vector<nano::uint256_union> messages (count);
+	std::vector<nano::signature> signatures (count);
+	std::vector<unsigned char const *> messages_l;
+	std::vector<size_t> lengths;
+	std::vector<unsigned char const *> public_keys;
+	std::vector<unsigned char const *> signatures_l;
+	for (size_t i = 0; i < count; ++i)
+	{
+		messages[i] = nano::uint256_union (i);
+		signatures[i] = nano::sign_message (keys[i].prv, keys[i].pub, messages[i]);
+		messages_l.push_back (messages[i].bytes.data ());
+		lengths.push_back (sizeof (messages[i].bytes));
+		public_keys.push_back (keys[i].pub.bytes.data ());
+		signatures_l.push_back (signatures[i].bytes.data ());
+	}
+
+	// S += 8 * L, little endian, where L is the order of the ed25519 base point
+	std::array<uint8_t, 32> const order{ 0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10 };
+	unsigned carry = 0;
+	for (size_t i = 0; i < order.size (); ++i)
+	{
+		auto const sum = signatures[2].bytes[32 + i] + 8u * order[i] + carry;
+		signatures[2].bytes[32 + i] = static_cast<uint8_t> (sum);
+		carry = sum >> 8;
+	}
+	ASSERT_EQ (0, carry);
+	ASSERT_NE (0, signatures[2].bytes[63] & 0xe0);
+	ASSERT_TRUE (nano::validate_message (keys[2].pub, messages[2], signatures[2]));
+
+	std::vector<int> valid (count, 1);
+	ASSERT_TRUE (nano::validate_message_batch (messages_l.data (), lengths.data (), public_keys.data (), signatures_l.data (), count, valid.data ()));
+	for (size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ (i == 2 ? 0 : 1, valid[i]);
+	}
+}
+
 TEST (transaction_block, empty)
 {
 	nano::keypair key1;
@@ -570,6 +644,32 @@ TEST (block_uniquer, single)
 	ASSERT_EQ (nullptr, block3.lock ());
 }
 
+// The keep callback only runs for the block that ends up stored
+TEST (block_uniquer, keep)
+{
+	nano::keypair key;
+	nano::state_block_builder builder;
+	auto block1 = builder
+				  .account (0)
+				  .previous (0)
+				  .representative (0)
+				  .balance (0)
+				  .link (0)
+				  .sign (key.prv, key.pub)
+				  .work (0)
+				  .build ();
+	auto block2 (std::make_shared<nano::state_block> (*block1));
+	nano::block_uniquer uniquer;
+	std::vector<nano::block const *> kept;
+	auto keep = [&kept] (nano::block & block) {
+		kept.push_back (&block);
+	};
+	ASSERT_EQ (block1, uniquer.unique (block1, keep));
+	ASSERT_EQ (block1, uniquer.unique (block2, keep));
+	ASSERT_EQ (1, kept.size ());
+	ASSERT_EQ (block1.get (), kept.front ());
+}
+
 TEST (block_uniquer, cleanup)
 {
 	nano::keypair key;
@@ -0,0 +1,198 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/logging.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/secure/block_cache.hpp>
+#include <nano/secure/ledger.hpp>
+#include <nano/secure/ledger_set_any.hpp>
+#include <nano/test_common/ledger_context.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::shared_ptr<nano::block> make_block (nano::block_hash const & previous)
+{
+	nano::block_builder builder;
+	auto block = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (previous)
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (0)
+				 .build ();
+	block->sideband_set ({});
+	return block;
+}
+}
+
+TEST (block_cache, put_get_erase)
+{
+	nano::logger logger;
+	nano::stats stats{ logger };
+	nano::block_cache cache{ nano::block_cache_config{}, stats };
+	auto block1 = make_block (1);
+	auto block2 = make_block (2);
+	ASSERT_EQ (nullptr, cache.get (block1->hash ()));
+	cache.put (block1);
+	cache.put (block2);
+	ASSERT_EQ (2, cache.size ());
+	ASSERT_EQ (block1, cache.get (block1->hash ()));
+	ASSERT_EQ (block2, cache.get (block2->hash ()));
+	cache.erase (block1->hash ());
+	ASSERT_EQ (nullptr, cache.get (block1->hash ()));
+	ASSERT_EQ (1, cache.size ());
+	ASSERT_EQ (nano::block_cache::entry_size (*block2), cache.memory ());
+	ASSERT_EQ (2, stats.count (nano::stat::type::block_cache, nano::stat::detail::hit));
+	ASSERT_EQ (2, stats.count (nano::stat::type::block_cache, nano::stat::detail::miss));
+}
+
+TEST (block_cache, eviction)
+{
+	nano::logger logger;
+	nano::stats stats{ logger };
+	auto const entry_size = nano::block_cache::entry_size (*make_block (0));
+	nano::block_cache_config config;
+	// Room for 4 blocks in every shard
+	config.max_size = entry_size * 4 * 16;
+	nano::block_cache cache{ config, stats };
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (int i = 0; i < 1024; ++i)
+	{
+		blocks.push_back (make_block (i + 1));
+		cache.put (blocks.back ());
+	}
+	ASSERT_LE (cache.memory (), config.max_size);
+	ASSERT_EQ (cache.memory (), cache.size () * entry_size);
+	ASSERT_EQ (blocks.size () - cache.size (), stats.count (nano::stat::type::block_cache, nano::stat::detail::evicted));
+	// Most recently inserted block is kept
+	ASSERT_EQ (blocks.back (), cache.get (blocks.back ()->hash ()));
+}
+
+TEST (block_cache, disabled)
+{
+	nano::logger logger;
+	nano::stats stats{ logger };
+	nano::block_cache_config config;
+	config.max_size = 0;
+	nano::block_cache cache{ config, stats };
+	auto block = make_block (1);
+	cache.put (block);
+	ASSERT_EQ (0, cache.size ());
+	ASSERT_EQ (nullptr, cache.get (block->hash ()));
+}
+
+// Processed blocks are served from the cache until their stored representation changes
+TEST (block_cache, ledger_invalidation)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & pool = ctx.pool ();
+	auto transaction = ledger.tx_begin_write ();
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send1));
+	// Only cached once committed
+	ASSERT_EQ (nullptr, ledger.block_cache.get (send1->hash ()));
+	transaction.refresh ();
+	ASSERT_EQ (send1, ledger.block_cache.get (send1->hash ()));
+	ASSERT_EQ (send1, ledger.any.block_get (transaction, send1->hash ()));
+	auto send2 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (send1->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send2));
+	// Successor of send1 was updated in the store
+	ASSERT_EQ (nullptr, ledger.block_cache.get (send1->hash ()));
+	ASSERT_EQ (send2->hash (), ledger.any.block_get (transaction, send1->hash ())->sideband ().successor);
+	ASSERT_FALSE (ledger.rollback (transaction, send2->hash ()));
+	ASSERT_EQ (nullptr, ledger.block_cache.get (send2->hash ()));
+	ASSERT_EQ (nullptr, ledger.any.block_get (transaction, send2->hash ()));
+	ASSERT_TRUE (ledger.any.block_get (transaction, send1->hash ())->sideband ().successor.is_zero ());
+}
+
+// Blocks rolled back before the transaction commits never become visible in the cache
+TEST (block_cache, rollback_before_commit)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & pool = ctx.pool ();
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (nano::dev::genesis_key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+		ASSERT_FALSE (ledger.rollback (transaction, send->hash ()));
+	}
+	ASSERT_EQ (nullptr, ledger.block_cache.get (send->hash ()));
+	ASSERT_EQ (nullptr, ledger.any.block_get (ledger.tx_begin_read (), send->hash ()));
+
+	// Destroying the transaction commits it and publishes the written blocks
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+	}
+	ASSERT_EQ (send, ledger.block_cache.get (send->hash ()));
+}
+
+// Bytes kept for relaying a received block are not pinned by the ledger's cache
+TEST (block_cache, wire_bytes_not_cached)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & pool = ctx.pool ();
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (nano::dev::genesis_key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	auto bytes = std::make_shared<std::vector<uint8_t>> ();
+	{
+		nano::vectorstream stream{ *bytes };
+		send->serialize (stream);
+	}
+	send->wire_bytes_set (bytes);
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+	}
+	auto cached = ledger.block_cache.get (send->hash ());
+	ASSERT_NE (nullptr, cached);
+	ASSERT_EQ (*send, *cached);
+	ASSERT_EQ (nullptr, cached->wire_bytes ());
+	ASSERT_NE (nullptr, send->wire_bytes ());
+}
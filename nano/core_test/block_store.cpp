@@ -9,11 +9,14 @@
 #include <nano/node/endpoint.hpp>
 #include <nano/node/make_store.hpp>
 #include <nano/secure/common.hpp>
+#include <nano/secure/delegator_key.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/utility.hpp>
 #include <nano/store/account.hpp>
 #include <nano/store/block.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/height.hpp>
 #include <nano/store/lmdb/lmdb.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/store/versioning.hpp>
@@ -182,6 +185,98 @@ TEST (block_store, clear_successor)
 	}
 }
 
+// Appending a block records its successor without rewriting the stored predecessor value
+TEST (block_store, successor_table)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	nano::block_builder builder;
+	auto block1 = builder
+				  .open ()
+				  .source (0)
+				  .representative (1)
+				  .account (0)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	block1->sideband_set ({});
+	auto block2 = builder
+				  .change ()
+				  .previous (block1->hash ())
+				  .representative (2)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	block2->sideband_set ({});
+	auto transaction (store->tx_begin_write ());
+	store->block.put (transaction, block1->hash (), *block1);
+	store->block.put (transaction, block2->hash (), *block2);
+	ASSERT_EQ (block2->hash (), store->block.successor (transaction, block1->hash ()));
+	ASSERT_EQ (block2->hash (), store->block.get (transaction, block1->hash ())->sideband ().successor);
+	// Stored value of the predecessor is unchanged, its embedded successor field stays empty
+	auto stored = store->block.begin (transaction, block1->hash ());
+	ASSERT_NE (store->block.end (transaction), stored);
+	ASSERT_EQ (block1->hash (), stored->first);
+	ASSERT_TRUE (stored->second.sideband.successor.is_zero ());
+	// Deleting a block removes its successor entry
+	store->block.del (transaction, block1->hash ());
+	ASSERT_FALSE (store->block.successor (transaction, block1->hash ()));
+}
+
+// Batched lookups return one entry per key in request order, including keys that are not found
+TEST (block_store, get_multi)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	nano::block_builder builder;
+	auto block1 = builder
+				  .open ()
+				  .source (0)
+				  .representative (1)
+				  .account (0)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	block1->sideband_set ({});
+	auto block2 = builder
+				  .change ()
+				  .previous (block1->hash ())
+				  .representative (2)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	block2->sideband_set ({});
+	nano::account_info info1{ block1->hash (), nano::account{ 1 }, block1->hash (), 10, 0, 1, nano::epoch::epoch_0 };
+	nano::pending_key pending_key1{ nano::account{ 1 }, block1->hash () };
+	nano::pending_info pending_info1{ nano::account{ 2 }, 3, nano::epoch::epoch_1 };
+	{
+		auto transaction (store->tx_begin_write ());
+		store->block.put (transaction, block1->hash (), *block1);
+		store->block.put (transaction, block2->hash (), *block2);
+		store->account.put (transaction, nano::account{ 1 }, info1);
+		store->pending.put (transaction, pending_key1, pending_info1);
+	}
+	auto transaction (store->tx_begin_read ());
+	auto blocks = store->block.get_multi (transaction, { block2->hash (), nano::block_hash{ 42 }, block1->hash () });
+	ASSERT_EQ (3, blocks.size ());
+	ASSERT_EQ (*block2, *blocks[0]);
+	ASSERT_EQ (nullptr, blocks[1]);
+	ASSERT_EQ (*block1, *blocks[2]);
+	ASSERT_EQ (block2->hash (), blocks[2]->sideband ().successor);
+	ASSERT_TRUE (blocks[0]->sideband ().successor.is_zero ());
+	auto accounts = store->account.get_multi (transaction, { nano::account{ 2 }, nano::account{ 1 } });
+	ASSERT_EQ (2, accounts.size ());
+	ASSERT_FALSE (accounts[0]);
+	ASSERT_EQ (info1, accounts[1]);
+	auto pending = store->pending.get_multi (transaction, { pending_key1, nano::pending_key{ nano::account{ 1 }, block2->hash () } });
+	ASSERT_EQ (2, pending.size ());
+	ASSERT_EQ (pending_info1, pending[0]);
+	ASSERT_FALSE (pending[1]);
+	ASSERT_TRUE (store->block.get_multi (transaction, {}).empty ());
+}
+
 TEST (block_store, add_nonempty_block)
 {
 	nano::logger logger;
@@ -1523,6 +1618,147 @@ TEST (mdb_block_store, upgrade_v22_to_v23)
 	ASSERT_EQ (42, store->rep_weight.get (txn, rep_b));
 }
 
+// Tests that the new delegators table gets filled with all existing accounts
+TEST (mdb_block_store, upgrade_v24_to_v25)
+{
+	nano::logger logger;
+	auto const path = nano::unique_path ();
+	nano::account rep_a{ 123 };
+	nano::account rep_b{ 456 };
+	// Setting the database to its 24th version state
+	{
+		auto store{ nano::make_store (logger, path, nano::dev::constants) };
+		auto txn{ store->tx_begin_write () };
+
+		nano::account_info info1{};
+		info1.representative = rep_a;
+		store->account.put (txn, 1, info1);
+
+		nano::account_info info2{};
+		info2.representative = rep_b;
+		store->account.put (txn, 2, info2);
+
+		nano::account_info info3{};
+		info3.representative = rep_a;
+		store->account.put (txn, 3, info3);
+
+		store->delegator.clear (txn);
+		store->version.put (txn, 24);
+	}
+
+	// Testing the upgrade code worked
+	auto store{ nano::make_store (logger, path, nano::dev::constants) };
+	auto txn (store->tx_begin_read ());
+	ASSERT_EQ (store->version.get (txn), store->version_current);
+
+	ASSERT_EQ (3, store->delegator.count (txn));
+	ASSERT_TRUE (store->delegator.exists (txn, rep_a, 1));
+	ASSERT_TRUE (store->delegator.exists (txn, rep_b, 2));
+	ASSERT_TRUE (store->delegator.exists (txn, rep_a, 3));
+}
+
+// Tests that successors embedded in block sidebands are moved to the successors table
+TEST (mdb_block_store, upgrade_v25_to_v26)
+{
+	nano::logger logger;
+	auto const path = nano::unique_path ();
+	nano::block_builder builder;
+	auto block1 = builder
+				  .open ()
+				  .source (0)
+				  .representative (1)
+				  .account (0)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	auto block2 = builder
+				  .change ()
+				  .previous (block1->hash ())
+				  .representative (2)
+				  .sign (nano::keypair ().prv, 0)
+				  .work (0)
+				  .build ();
+	// Setting the database to its 25th version state, where successors were stored inside the block value
+	{
+		auto store{ nano::make_store (logger, path, nano::dev::constants) };
+		auto txn{ store->tx_begin_write () };
+		auto put_v25 = [&] (nano::block & block, nano::block_hash const & successor) {
+			nano::block_sideband sideband{};
+			sideband.successor = successor;
+			std::vector<uint8_t> vector;
+			{
+				nano::vectorstream stream (vector);
+				nano::serialize_block (stream, block);
+				sideband.serialize (stream, block.type ());
+			}
+			store->block.raw_put (txn, vector, block.hash ());
+		};
+		put_v25 (*block1, block2->hash ());
+		put_v25 (*block2, 0);
+		ASSERT_FALSE (store->block.successor (txn, block1->hash ()));
+		store->version.put (txn, 25);
+	}
+
+	// Testing the upgrade code worked
+	auto store{ nano::make_store (logger, path, nano::dev::constants) };
+	auto txn (store->tx_begin_read ());
+	ASSERT_EQ (store->version.get (txn), store->version_current);
+
+	ASSERT_EQ (block2->hash (), store->block.successor (txn, block1->hash ()));
+	ASSERT_EQ (block2->hash (), store->block.get (txn, block1->hash ())->sideband ().successor);
+	ASSERT_FALSE (store->block.successor (txn, block2->hash ()));
+}
+
+TEST (mdb_block_store, upgrade_v26_to_v27)
+{
+	nano::logger logger;
+	auto const path = nano::unique_path ();
+	nano::keypair key;
+	nano::block_builder builder;
+	auto block1 = builder
+				  .open ()
+				  .source (0)
+				  .representative (1)
+				  .account (key.pub)
+				  .sign (key.prv, key.pub)
+				  .work (0)
+				  .build ();
+	nano::block_sideband sideband1;
+	sideband1.height = 1;
+	block1->sideband_set (sideband1);
+	auto block2 = builder
+				  .change ()
+				  .previous (block1->hash ())
+				  .representative (2)
+				  .sign (key.prv, key.pub)
+				  .work (0)
+				  .build ();
+	nano::block_sideband sideband2;
+	sideband2.account = key.pub;
+	sideband2.height = 2;
+	block2->sideband_set (sideband2);
+	// Setting the database to its 26th version state, before the heights table existed
+	{
+		auto store{ nano::make_store (logger, path, nano::dev::constants) };
+		auto txn{ store->tx_begin_write () };
+		store->block.put (txn, block1->hash (), *block1);
+		store->block.put (txn, block2->hash (), *block2);
+		store->height.clear (txn);
+		store->version.put (txn, 26);
+	}
+
+	// Testing the upgrade code worked
+	auto store{ nano::make_store (logger, path, nano::dev::constants) };
+	auto txn (store->tx_begin_read ());
+	ASSERT_EQ (store->version.get (txn), store->version_current);
+
+	ASSERT_EQ (3, store->height.count (txn));
+	ASSERT_EQ (nano::dev::genesis->hash (), store->height.get (txn, nano::dev::genesis_key.pub, 1));
+	ASSERT_EQ (block1->hash (), store->height.get (txn, key.pub, 1));
+	ASSERT_EQ (block2->hash (), store->height.get (txn, key.pub, 2));
+	ASSERT_FALSE (store->height.get (txn, key.pub, 3));
+}
+
 TEST (mdb_block_store, upgrade_backup)
 {
 	if (nano::rocksdb_config::using_rocksdb_in_tests ())
@@ -1636,6 +1872,36 @@ TEST (block_store, final_vote)
 	}
 }
 
+TEST (block_store, delegators)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	nano::account rep_a{ 10 };
+	nano::account rep_b{ 20 };
+	auto transaction (store->tx_begin_write ());
+	store->delegator.put (transaction, rep_b, 1);
+	store->delegator.put (transaction, rep_a, 3);
+	store->delegator.put (transaction, rep_a, 2);
+	ASSERT_EQ (3, store->delegator.count (transaction));
+	ASSERT_TRUE (store->delegator.exists (transaction, rep_a, 2));
+	ASSERT_FALSE (store->delegator.exists (transaction, rep_b, 2));
+
+	// Delegators of a representative are contiguous and ordered by account
+	std::vector<nano::account> delegators;
+	for (auto i (store->delegator.begin (transaction, nano::delegator_key{ rep_a, 0 })), n (store->delegator.end (transaction)); i != n && i->first.representative == rep_a; ++i)
+	{
+		delegators.push_back (i->first.account);
+	}
+	ASSERT_EQ ((std::vector<nano::account>{ 2, 3 }), delegators);
+
+	store->delegator.del (transaction, rep_a, 2);
+	ASSERT_FALSE (store->delegator.exists (transaction, rep_a, 2));
+	auto i (store->delegator.begin (transaction, nano::delegator_key{ rep_a, 0 }));
+	ASSERT_NE (store->delegator.end (transaction), i);
+	ASSERT_EQ (nano::delegator_key (rep_a, 3), i->first);
+}
+
 // Ledger versions are not forward compatible
 TEST (block_store, incompatible_version)
 {
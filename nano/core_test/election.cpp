@@ -307,3 +307,62 @@ TEST (election, continuous_voting)
 	// Ensure votes are broadcasted in continuous manner
 	ASSERT_TIMELY (5s, node1.stats.count (nano::stat::type::election, nano::stat::detail::broadcast_vote) >= 5);
 }
+
+// The running tally must move a representative's weight when it changes its vote
+TEST (election, tally_follows_vote_change)
+{
+	nano::test::system system{};
+
+	nano::node_config node_config = system.default_config ();
+	node_config.backlog_population.enable = false;
+	auto & node1 = *system.add_node (node_config);
+	auto const latest_hash = nano::dev::genesis->hash ();
+	nano::state_block_builder builder{};
+
+	nano::keypair key1{};
+	auto send1 = builder.make_block ()
+				 .previous (latest_hash)
+				 .account (nano::dev::genesis_key.pub)
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (key1.pub)
+				 .work (*system.work.generate (latest_hash))
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .build ();
+
+	nano::keypair key2{};
+	auto send2 = builder.make_block ()
+				 .previous (latest_hash)
+				 .account (nano::dev::genesis_key.pub)
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (key2.pub)
+				 .work (*system.work.generate (latest_hash))
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .build ();
+
+	node1.process_active (send1);
+	std::shared_ptr<nano::election> election{};
+	ASSERT_TIMELY (5s, (election = node1.active.election (send1->qualified_root ())) != nullptr)
+	node1.process_active (send2);
+	ASSERT_TIMELY_EQ (5s, election->blocks ().size (), 2);
+
+	auto const weight = node1.ledger.weight (nano::dev::genesis_key.pub);
+	ASSERT_EQ (nano::vote_code::vote, election->vote (nano::dev::genesis_key.pub, 1, send1->hash (), nano::vote_source::cache));
+	auto tally1 = election->tally ();
+	ASSERT_FALSE (tally1.empty ());
+	ASSERT_EQ (weight, tally1.begin ()->first);
+	ASSERT_EQ (*send1, *tally1.begin ()->second);
+
+	ASSERT_EQ (nano::vote_code::vote, election->vote (nano::dev::genesis_key.pub, 2, send2->hash (), nano::vote_source::cache));
+	auto tally2 = election->tally ();
+	ASSERT_FALSE (tally2.empty ());
+	ASSERT_EQ (weight, tally2.begin ()->first);
+	ASSERT_EQ (*send2, *tally2.begin ()->second);
+	nano::uint128_t total{ 0 };
+	for (auto const & [amount, block] : tally2)
+	{
+		total += amount;
+	}
+	ASSERT_EQ (weight, total);
+}
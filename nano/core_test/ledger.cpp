@@ -13,7 +13,11 @@
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
 #include <nano/secure/vote.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/height.hpp>
+#include <nano/store/rocksdb/lmdb_import.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/version.hpp>
 #include <nano/test_common/ledger_context.hpp>
 #include <nano/test_common/make_store.hpp>
 #include <nano/test_common/system.hpp>
@@ -21,7 +25,10 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <future>
 #include <limits>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -543,6 +550,72 @@ TEST (ledger, representative_change)
 	ASSERT_EQ (0, ledger.weight (key2.pub));
 }
 
+// The delegators index follows the representative of each account through processing and rollback
+TEST (ledger, delegators)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto transaction = ledger.tx_begin_write ();
+	nano::keypair key1;
+	nano::keypair key2;
+	auto & pool = ctx.pool ();
+	ASSERT_TRUE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	nano::block_builder builder;
+	auto change = builder
+				  .change ()
+				  .previous (nano::dev::genesis->hash ())
+				  .representative (key1.pub)
+				  .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				  .work (*pool.generate (nano::dev::genesis->hash ()))
+				  .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, change));
+	ASSERT_FALSE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	ASSERT_TRUE (store.delegator.exists (transaction, key1.pub, nano::dev::genesis_key.pub));
+	auto send = builder
+				.send ()
+				.previous (change->hash ())
+				.destination (key2.pub)
+				.balance (nano::dev::constants.genesis_amount - 100)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (change->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send));
+	auto open = builder
+				.open ()
+				.source (send->hash ())
+				.representative (key1.pub)
+				.account (key2.pub)
+				.sign (key2.prv, key2.pub)
+				.work (*pool.generate (key2.pub))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, open));
+	ASSERT_TRUE (store.delegator.exists (transaction, key1.pub, key2.pub));
+	ASSERT_EQ (2, store.delegator.count (transaction));
+	std::set<nano::account> delegators;
+	for (auto i = ledger.any.delegator_begin (transaction, key1.pub), n = ledger.any.delegator_end (); i != n; ++i)
+	{
+		ASSERT_EQ (key1.pub, i->first.representative);
+		ASSERT_EQ (ledger.any.account_balance (transaction, i->first.account), i->second.balance);
+		delegators.insert (i->first.account);
+	}
+	ASSERT_EQ ((std::set<nano::account>{ nano::dev::genesis_key.pub, key2.pub }), delegators);
+	auto first = std::min (nano::dev::genesis_key.pub, key2.pub);
+	auto second = std::max (nano::dev::genesis_key.pub, key2.pub);
+	auto upper = ledger.any.delegator_upper_bound (transaction, key1.pub, first);
+	ASSERT_NE (ledger.any.delegator_end (), upper);
+	ASSERT_EQ (second, upper->first.account);
+	ASSERT_EQ (ledger.any.delegator_end (), ++upper);
+	ASSERT_EQ (ledger.any.delegator_end (), ledger.any.delegator_upper_bound (transaction, key1.pub, second));
+	ASSERT_EQ (ledger.any.delegator_end (), ledger.any.delegator_begin (transaction, nano::dev::genesis_key.pub));
+	ASSERT_FALSE (ledger.rollback (transaction, open->hash ()));
+	ASSERT_FALSE (store.delegator.exists (transaction, key1.pub, key2.pub));
+	ASSERT_FALSE (ledger.rollback (transaction, change->hash ()));
+	ASSERT_TRUE (store.delegator.exists (transaction, nano::dev::genesis_key.pub, nano::dev::genesis_key.pub));
+	ASSERT_FALSE (store.delegator.exists (transaction, key1.pub, nano::dev::genesis_key.pub));
+	ASSERT_EQ (1, store.delegator.count (transaction));
+}
+
 TEST (ledger, send_fork)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -733,6 +806,92 @@ TEST (ledger, rep_cache_min_weight)
 	ASSERT_EQ (1, store->rep_weight.count (txn));
 }
 
+// Weights stay correct when changes are folded from the delta into a new base table
+TEST (ledger, rep_weights_rebuild)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight };
+	auto txn{ store->tx_begin_write () };
+	auto const count = nano::rep_weights::delta_max * 3;
+	for (unsigned i = 1; i <= count; ++i)
+	{
+		rep_weights.representation_add (txn, i, i);
+	}
+	ASSERT_EQ (count, rep_weights.size ());
+	// Remove every other representative
+	for (unsigned i = 2; i <= count; i += 2)
+	{
+		rep_weights.representation_add (txn, i, nano::uint128_t{ 0 } - i);
+	}
+	ASSERT_EQ (count / 2, rep_weights.size ());
+	for (unsigned i = 1; i <= count; ++i)
+	{
+		ASSERT_EQ (i % 2 == 1 ? i : 0, rep_weights.representation_get (i));
+	}
+	auto const amounts = rep_weights.get_rep_amounts ();
+	ASSERT_EQ (count / 2, amounts.size ());
+	ASSERT_EQ (1, amounts.count (1));
+	ASSERT_EQ (0, amounts.count (2));
+}
+
+// Readers observe either the previous or the new weight while writers publish snapshots
+TEST (ledger, rep_weights_concurrent_read)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight };
+	auto txn{ store->tx_begin_write () };
+	rep_weights.representation_add (txn, 1, 1);
+	std::atomic<bool> stop{ false };
+	std::atomic<bool> invalid{ false };
+	std::thread reader ([&] () {
+		nano::uint128_t last{ 1 };
+		while (!stop)
+		{
+			auto current = rep_weights.representation_get (1);
+			// Weight of representative 1 only ever increases
+			invalid = invalid || current < last;
+			last = current;
+		}
+	});
+	for (unsigned i = 0; i < nano::rep_weights::delta_max * 4; ++i)
+	{
+		rep_weights.representation_add_dual (txn, 1, 1, i + 2, 1);
+	}
+	stop = true;
+	reader.join ();
+	ASSERT_FALSE (invalid);
+	ASSERT_EQ (nano::rep_weights::delta_max * 4 + 1, rep_weights.representation_get (1));
+}
+
+// Weights collected by a builder are added on top of the cached weights, below the minimum weight they are not cached
+TEST (ledger, rep_weights_builder)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight, 10 };
+	rep_weights.representation_put (1, 100);
+	nano::rep_weights::builder builder;
+	auto const count = nano::rep_weights::delta_max * 3;
+	for (unsigned i = 1; i <= count; ++i)
+	{
+		builder.add (i, 10);
+	}
+	builder.add (2, 5);
+	builder.add (3, nano::uint128_t{ 0 } - 5);
+	rep_weights.add (builder);
+	ASSERT_EQ (count - 1, rep_weights.size ());
+	ASSERT_EQ (110, rep_weights.representation_get (1));
+	ASSERT_EQ (15, rep_weights.representation_get (2));
+	ASSERT_EQ (0, rep_weights.representation_get (3));
+	ASSERT_EQ (10, rep_weights.representation_get (count));
+
+	// Lookups alternating between instances on one thread see the weights of the right instance
+	nano::rep_weights other{ store->rep_weight };
+	other.representation_put (1, 7);
+	ASSERT_EQ (110, rep_weights.representation_get (1));
+	ASSERT_EQ (7, other.representation_get (1));
+	ASSERT_EQ (110, rep_weights.representation_get (1));
+}
+
 TEST (ledger, representation)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -1307,6 +1466,67 @@ TEST (ledger, fail_state_bad_signature)
 	ASSERT_EQ (nano::block_status::bad_signature, result1);
 }
 
+// Pre-verified signature and work results are used instead of checking the block again
+TEST (ledger, process_verified)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto transaction = ledger.tx_begin_write ();
+	auto & pool = ctx.pool ();
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (key1.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	auto verification = nano::block_verification::verify (*send, ledger.constants);
+	ASSERT_EQ (1, verification.signatures.size ());
+	ASSERT_EQ (true, verification.signature_valid (nano::dev::genesis_key.pub));
+	ASSERT_FALSE (verification.signature_valid (key1.pub));
+	ASSERT_EQ (ledger.constants.work.difficulty (*send), verification.difficulty);
+
+	auto bad_signature = verification;
+	bad_signature.signatures.front ().second = false;
+	ASSERT_EQ (nano::block_status::bad_signature, ledger.process (transaction, send, bad_signature));
+
+	auto bad_work = verification;
+	bad_work.difficulty = 0;
+	ASSERT_EQ (nano::block_status::insufficient_work, ledger.process (transaction, send, bad_work));
+
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send, verification));
+}
+
+// State blocks with an epoch link are checked against both the account and the epoch signer
+TEST (ledger, process_verified_epoch)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto transaction = ledger.tx_begin_write ();
+	auto & pool = ctx.pool ();
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto epoch1 = builder
+				  .state ()
+				  .account (key1.pub)
+				  .previous (0)
+				  .representative (0)
+				  .balance (0)
+				  .link (ledger.epoch_link (nano::epoch::epoch_1))
+				  .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				  .work (*pool.generate (key1.pub))
+				  .build ();
+	auto verification = nano::block_verification::verify (*epoch1, ledger.constants);
+	ASSERT_EQ (2, verification.signatures.size ());
+	ASSERT_EQ (false, verification.signature_valid (key1.pub));
+	ASSERT_EQ (true, verification.signature_valid (ledger.epoch_signer (epoch1->link_field ().value ())));
+}
+
 TEST (ledger, fail_epoch_bad_signature)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -4867,6 +5087,80 @@ TEST (ledger, cache)
 	}
 }
 
+// The persisted cache snapshot is used on startup only while no ledger write happened after it
+TEST (ledger, cache_snapshot)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & pool = ctx.pool ();
+	nano::logger logger;
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (nano::dev::genesis_key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (ledger.tx_begin_write (), send));
+	ledger.cache_snapshot_write ();
+	ASSERT_TRUE (store.version.cache_snapshot_get (store.tx_begin_read ()));
+	{
+		nano::stats stats{ logger };
+		nano::ledger ledger2 (store, stats, nano::dev::constants);
+		ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_loaded));
+		ASSERT_EQ (2, ledger2.block_count ());
+		ASSERT_EQ (1, ledger2.account_count ());
+		ASSERT_EQ (1, ledger2.cemented_count ());
+		ASSERT_EQ (nano::dev::constants.genesis_amount - 1, ledger2.weight (nano::dev::genesis_key.pub));
+	}
+	// Any ledger write deletes the snapshot
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ledger.confirm (transaction, send->hash ());
+	}
+	ASSERT_FALSE (store.version.cache_snapshot_get (store.tx_begin_read ()));
+	{
+		nano::stats stats{ logger };
+		nano::ledger ledger2 (store, stats, nano::dev::constants);
+		ASSERT_EQ (0, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_loaded));
+		ASSERT_EQ (2, ledger2.cemented_count ());
+	}
+	// Corrupted snapshots fall back to scanning the ledger
+	ledger.cache_snapshot_write ();
+	{
+		auto transaction = store.tx_begin_write ();
+		auto snapshot = *store.version.cache_snapshot_get (transaction);
+		snapshot[1] ^= 1;
+		store.version.cache_snapshot_put (transaction, snapshot);
+	}
+	{
+		nano::stats stats{ logger };
+		nano::ledger ledger2 (store, stats, nano::dev::constants);
+		ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_invalid));
+		ASSERT_EQ (2, ledger2.block_count ());
+		ASSERT_EQ (2, ledger2.cemented_count ());
+		ASSERT_EQ (nano::dev::constants.genesis_amount - 1, ledger2.weight (nano::dev::genesis_key.pub));
+	}
+	// Incomplete caches are not persisted, the snapshot written by a complete ledger is kept
+	ledger.cache_snapshot_write ();
+	auto const snapshot = store.version.cache_snapshot_get (store.tx_begin_read ());
+	ASSERT_TRUE (snapshot);
+	{
+		nano::stats stats{ logger };
+		nano::generate_cache_flags flags;
+		flags.reps = false;
+		nano::ledger ledger2 (store, stats, nano::dev::constants, flags);
+		ledger2.cache_snapshot_write ();
+		ASSERT_EQ (0, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_written));
+		ASSERT_EQ (snapshot, store.version.cache_snapshot_get (store.tx_begin_read ()));
+	}
+}
+
 TEST (ledger, pruning_action)
 {
 	nano::logger logger;
@@ -5490,6 +5784,45 @@ TEST (ledger, migrate_lmdb_to_rocksdb)
 	ASSERT_EQ (error_on_retry, true);
 }
 
+// An interrupted migration continues with the ranges missing from its checkpoint
+TEST (ledger, migrate_lmdb_to_rocksdb_resume)
+{
+	nano::test::system system{};
+	auto path = nano::unique_path ();
+	nano::logger logger;
+	nano::store::lmdb::component store{ logger, path / "data.ldb", nano::dev::constants };
+	nano::ledger ledger{ store, system.stats, nano::dev::constants };
+	nano::pending_key key{ nano::dev::genesis_key.pub, 1 };
+	{
+		auto transaction = ledger.tx_begin_write ();
+		store.initialize (transaction, ledger.cache, ledger.constants);
+		ASSERT_FALSE (store.init_error ());
+		store.pending.put (transaction, key, nano::pending_info (nano::dev::genesis_key.pub, 100, nano::epoch::epoch_0));
+	}
+
+	// Leftovers of an earlier run which imported every range of the pending table
+	{
+		nano::store::rocksdb::component rocksdb_store{ logger, path / "rocksdb", nano::dev::constants };
+		ASSERT_FALSE (rocksdb_store.init_error ());
+	}
+	std::filesystem::create_directories (path / "rocksdb_migration");
+	{
+		std::ofstream checkpoint{ path / "rocksdb_migration" / "checkpoint" };
+		for (unsigned index = 0; index < nano::store::rocksdb::lmdb_import::ranges_per_table; ++index)
+		{
+			checkpoint << static_cast<unsigned> (nano::tables::pending) << ' ' << index << std::endl;
+		}
+	}
+
+	ASSERT_FALSE (ledger.migrate_lmdb_to_rocksdb (path));
+	ASSERT_FALSE (std::filesystem::exists (path / "rocksdb_migration"));
+
+	nano::store::rocksdb::component rocksdb_store{ logger, path / "rocksdb", nano::dev::constants };
+	auto transaction = rocksdb_store.tx_begin_read ();
+	ASSERT_NE (nullptr, rocksdb_store.block.get (transaction, nano::dev::genesis->hash ()));
+	ASSERT_FALSE (rocksdb_store.pending.get (transaction, key));
+}
+
 TEST (ledger, is_send_genesis)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -5895,4 +6228,127 @@ TEST (ledger_transaction, multithreaded_interleaving)
 	{
 		thread.join ();
 	}
-}
\ No newline at end of file
+}
+
+// Writers submitting while the write queue is busy share a single write transaction
+TEST (ledger, write_group)
+{
+	nano::test::system system;
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & stats = ctx.stats ();
+	std::optional<nano::store::write_guard> guard{ store.write_queue.wait (nano::store::writer::testing) };
+	auto submit = [&] (nano::store::writer writer, nano::account const & account) {
+		return std::async (std::launch::async, [&ledger, &store, writer, account] () {
+			ledger.write_group.submit (writer, [&store, account] (nano::secure::write_transaction & transaction) {
+				store.account.put (transaction, account, nano::account_info{});
+			});
+		});
+	};
+	auto future1 = submit (nano::store::writer::blockprocessor, nano::account{ 1 });
+	ASSERT_TIMELY_EQ (5s, ledger.write_group.size (), 1);
+	auto future2 = submit (nano::store::writer::confirmation_height, nano::account{ 2 });
+	ASSERT_TIMELY_EQ (5s, ledger.write_group.size (), 2);
+	guard.reset ();
+	future1.wait ();
+	future2.wait ();
+	ASSERT_EQ (1, stats.count (nano::stat::type::write_group, nano::stat::detail::commit));
+	ASSERT_EQ (1, stats.count (nano::stat::type::write_group, nano::stat::detail::grouped));
+	ASSERT_EQ (1, stats.count (nano::stat::type::write_group_writer, nano::stat::detail::blockprocessor));
+	ASSERT_EQ (1, stats.count (nano::stat::type::write_group_writer, nano::stat::detail::confirmation_height));
+	auto transaction = ledger.tx_begin_read ();
+	ASSERT_TRUE (store.account.exists (transaction, nano::account{ 1 }));
+	ASSERT_TRUE (store.account.exists (transaction, nano::account{ 2 }));
+}
+
+// A failing writer aborts the shared transaction, none of the writes in its group are committed
+TEST (ledger, write_group_exception)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & stats = ctx.stats ();
+	auto wait_pending = [&ledger] (std::size_t count) {
+		while (ledger.write_group.size () < count)
+		{
+			std::this_thread::yield ();
+		}
+	};
+	std::optional<nano::store::write_guard> guard{ store.write_queue.wait (nano::store::writer::testing) };
+	auto future1 = std::async (std::launch::async, [&ledger, &store] () {
+		ledger.write_group.submit (nano::store::writer::blockprocessor, [&store] (nano::secure::write_transaction & transaction) {
+			store.account.put (transaction, nano::account{ 1 }, nano::account_info{});
+		});
+	});
+	wait_pending (1);
+	auto future2 = std::async (std::launch::async, [&ledger, &store] () {
+		ledger.write_group.submit (nano::store::writer::confirmation_height, [&store] (nano::secure::write_transaction & transaction) {
+			store.account.put (transaction, nano::account{ 2 }, nano::account_info{});
+			throw std::invalid_argument{ "failed" };
+		});
+	});
+	wait_pending (2);
+	guard.reset ();
+	ASSERT_THROW (future1.get (), std::runtime_error);
+	ASSERT_THROW (future2.get (), std::invalid_argument);
+	ASSERT_EQ (1, stats.count (nano::stat::type::write_group, nano::stat::detail::aborted));
+	{
+		auto transaction = ledger.tx_begin_read ();
+		ASSERT_FALSE (store.account.exists (transaction, nano::account{ 1 }));
+		ASSERT_FALSE (store.account.exists (transaction, nano::account{ 2 }));
+	}
+	// The group is released, later writers are not blocked by a stale leader
+	ledger.write_group.submit (nano::store::writer::testing, [&store] (nano::secure::write_transaction & transaction) {
+		store.account.put (transaction, nano::account{ 3 }, nano::account_info{});
+	});
+	auto transaction = ledger.tx_begin_read ();
+	ASSERT_TRUE (store.account.exists (transaction, nano::account{ 3 }));
+}
+
+// Height index follows the account chain through processing, rollback and pruning
+TEST (ledger, block_hash_at_height)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & pool = ctx.pool ();
+	ledger.pruning = true;
+	auto transaction = ledger.tx_begin_write ();
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send1));
+	auto send2 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2)
+				 .link (nano::dev::genesis_key.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (send1->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send2));
+	ASSERT_EQ (nano::dev::genesis->hash (), ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 1));
+	ASSERT_EQ (send1->hash (), ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 2));
+	ASSERT_EQ (send2->hash (), ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 3));
+	ASSERT_FALSE (ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 4));
+	ASSERT_EQ (3, store.height.count (transaction));
+	ASSERT_FALSE (ledger.rollback (transaction, send2->hash ()));
+	ASSERT_FALSE (ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 3));
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send2));
+	ledger.confirm (transaction, send1->hash ());
+	ASSERT_EQ (1, ledger.pruning_action (transaction, send1->hash (), 1));
+	ASSERT_FALSE (ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 2));
+	ASSERT_EQ (send2->hash (), ledger.any.block_hash_at_height (transaction, nano::dev::genesis_key.pub, 3));
+	ASSERT_EQ (2, store.height.count (transaction));
+}
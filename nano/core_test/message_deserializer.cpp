@@ -1,11 +1,14 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/node/transport/message_deserializer.hpp>
+#include <nano/node/transport/traffic_capture.hpp>
 #include <nano/secure/vote.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -204,3 +207,223 @@ TEST (message_deserializer, exact_asc_pull_ack)
 
 	message_deserializer_success_checker<decltype (message)> (message);
 }
+
+// Messages captured by the deserializer are read back byte for byte, in order and with their channel ids
+TEST (message_deserializer, capture_traffic)
+{
+	nano::network_filter filter (1);
+	nano::block_uniquer block_uniquer;
+	nano::vote_uniquer vote_uniquer;
+	auto const path = nano::unique_path () / "traffic.capture";
+	std::filesystem::create_directories (path.parent_path ());
+
+	std::vector<std::vector<uint8_t>> messages;
+	messages.push_back (*nano::keepalive{ nano::dev::network_params.network }.to_bytes ());
+	messages.push_back (*nano::confirm_req{ nano::dev::network_params.network, nano::test::random_hash (), nano::test::random_hash () }.to_bytes ());
+	{
+		nano::transport::traffic_recorder recorder{ path, nano::dev::network_params.network };
+		ASSERT_FALSE (recorder.init_error ());
+		auto const channel_id = recorder.channel_id_next ();
+		ASSERT_NE (channel_id, recorder.channel_id_next ());
+
+		std::vector<uint8_t> const * input = nullptr;
+		std::size_t offset{ 0 };
+		auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
+		[&input, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+			std::copy_n (input->begin () + offset, size_a, data_a->begin ());
+			offset += size_a;
+			callback_a (boost::system::errc::make_error_code (boost::system::errc::success), size_a);
+		});
+		message_deserializer->capture = [&recorder, channel_id] (nano::message_header const & header, uint8_t const * payload, std::size_t payload_size) {
+			recorder.record (channel_id, header, payload, payload_size);
+		};
+		for (auto const & message : messages)
+		{
+			input = &message;
+			offset = 0;
+			message_deserializer->status = nano::transport::parse_status::none;
+			message_deserializer->read ([] (boost::system::error_code ec_a, std::unique_ptr<nano::message> message_a) {
+				ASSERT_NE (nullptr, message_a);
+			});
+		}
+		ASSERT_EQ (messages.size (), recorder.recorded ());
+	}
+
+	nano::transport::traffic_reader reader{ path };
+	ASSERT_FALSE (reader.init_error ());
+	ASSERT_EQ (nano::dev::network_params.network.current_network, reader.network ());
+	std::chrono::microseconds last{ 0 };
+	for (auto const & message : messages)
+	{
+		auto record = reader.next ();
+		ASSERT_TRUE (record);
+		ASSERT_EQ (1, record->channel_id);
+		ASSERT_GE (record->timestamp, last);
+		ASSERT_EQ (message, record->data);
+		last = record->timestamp;
+	}
+	ASSERT_FALSE (reader.next ());
+}
+
+// A record claiming a size no message can have marks the capture as corrupt instead of being allocated
+TEST (message_deserializer, capture_traffic_oversized)
+{
+	auto const path = nano::unique_path () / "traffic.capture";
+	std::filesystem::create_directories (path.parent_path ());
+	{
+		nano::transport::traffic_recorder recorder{ path, nano::dev::network_params.network };
+		ASSERT_FALSE (recorder.init_error ());
+	}
+	{
+		std::ofstream file{ path, std::ios::binary | std::ios::app };
+		uint64_t const timestamp{ 0 };
+		uint64_t const channel_id{ 1 };
+		uint32_t const size{ std::numeric_limits<uint32_t>::max () };
+		file.write (reinterpret_cast<char const *> (&timestamp), sizeof (timestamp));
+		file.write (reinterpret_cast<char const *> (&channel_id), sizeof (channel_id));
+		file.write (reinterpret_cast<char const *> (&size), sizeof (size));
+	}
+
+	nano::transport::traffic_reader reader{ path };
+	ASSERT_FALSE (reader.init_error ());
+	ASSERT_FALSE (reader.next ());
+	ASSERT_FALSE (reader.next ());
+}
+
+// Buffered reads parse every complete message of a read, including messages split across reads
+TEST (message_deserializer, buffered_reads)
+{
+	nano::network_filter filter (1);
+	nano::block_uniquer block_uniquer;
+	nano::vote_uniquer vote_uniquer;
+
+	std::vector<std::vector<uint8_t>> messages;
+	std::vector<uint8_t> input;
+	for (auto i = 0; i < 50; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			messages.push_back (*nano::keepalive{ nano::dev::network_params.network }.to_bytes ());
+		}
+		else
+		{
+			messages.push_back (*nano::confirm_req{ nano::dev::network_params.network, nano::test::random_hash (), nano::test::random_hash () }.to_bytes ());
+		}
+		input.insert (input.end (), messages.back ().begin (), messages.back ().end ());
+	}
+
+	std::size_t offset{ 0 };
+	std::size_t read_count{ 0 };
+	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
+	[] (std::shared_ptr<std::vector<uint8_t>> const &, std::size_t, std::function<void (boost::system::error_code const &, std::size_t)>) {
+		FAIL () << "Exact reads must not be used when buffered reads are available";
+	});
+	message_deserializer->read_some = [&] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+		++read_count;
+		// Odd sized chunks so messages and headers get split between reads
+		auto const available = std::min ({ size_a, input.size () - offset, std::size_t{ 333 } });
+		if (available == 0)
+		{
+			callback_a (boost::asio::error::eof, 0);
+			return;
+		}
+		std::copy_n (input.begin () + offset, available, data_a->begin () + offset_a);
+		offset += available;
+		callback_a (boost::system::error_code{}, available);
+	};
+
+	std::vector<std::vector<uint8_t>> received;
+	boost::system::error_code last_error;
+	std::function<void (boost::system::error_code, std::unique_ptr<nano::message>)> callback;
+	callback = [&] (boost::system::error_code ec_a, std::unique_ptr<nano::message> message_a) {
+		if (ec_a)
+		{
+			last_error = ec_a;
+			return;
+		}
+		ASSERT_NE (nullptr, message_a);
+		received.push_back (*message_a->to_bytes ());
+		message_deserializer->read (std::move (callback));
+	};
+	message_deserializer->read (std::move (callback));
+
+	ASSERT_EQ (boost::asio::error::eof, last_error);
+	ASSERT_EQ (messages, received);
+	ASSERT_LT (read_count, messages.size ());
+}
+
+// Blocks and votes keep the payload they were received with, relaying them only serializes a new header
+TEST (message_deserializer, wire_bytes)
+{
+	nano::test::system system;
+	nano::network_filter filter (1);
+	nano::block_uniquer block_uniquer;
+	nano::vote_uniquer vote_uniquer;
+
+	nano::block_builder builder;
+	auto block = builder
+				 .send ()
+				 .previous (1)
+				 .destination (1)
+				 .balance (2)
+				 .sign (nano::keypair ().prv, 4)
+				 .work (*system.work.generate (nano::root (1)))
+				 .build ();
+	auto vote = nano::test::make_vote (nano::keypair{}, { block });
+	ASSERT_EQ (nullptr, block->wire_bytes ());
+	ASSERT_EQ (nullptr, vote->wire_bytes ());
+
+	auto input = *nano::publish{ nano::dev::network_params.network, block }.to_bytes ();
+	auto const vote_bytes = *nano::confirm_ack{ nano::dev::network_params.network, vote }.to_bytes ();
+	input.insert (input.end (), vote_bytes.begin (), vote_bytes.end ());
+
+	std::size_t offset{ 0 };
+	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
+	[&input, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+		data_a->resize (size_a);
+		std::copy_n (input.begin () + offset, size_a, data_a->begin ());
+		offset += size_a;
+		callback_a (boost::system::error_code{}, size_a);
+	});
+
+	std::shared_ptr<nano::block> received_block;
+	message_deserializer->read ([&received_block] (boost::system::error_code ec_a, std::unique_ptr<nano::message> message_a) {
+		auto publish = dynamic_cast<nano::publish *> (message_a.get ());
+		ASSERT_NE (nullptr, publish);
+		received_block = publish->block;
+	});
+	std::shared_ptr<nano::vote> received_vote;
+	message_deserializer->read ([&received_vote] (boost::system::error_code ec_a, std::unique_ptr<nano::message> message_a) {
+		auto confirm_ack = dynamic_cast<nano::confirm_ack *> (message_a.get ());
+		ASSERT_NE (nullptr, confirm_ack);
+		received_vote = confirm_ack->vote;
+	});
+	ASSERT_NE (nullptr, received_block);
+	ASSERT_NE (nullptr, received_vote);
+	ASSERT_NE (nullptr, received_block->wire_bytes ());
+	ASSERT_NE (nullptr, received_vote->wire_bytes ());
+
+	// Header flags differ from the received message, the payload is sent as a separate buffer
+	nano::publish publish{ nano::dev::network_params.network, received_block, true };
+	auto publish_buffer = publish.to_shared_const_buffer ();
+	ASSERT_EQ (2, std::distance (publish_buffer.begin (), publish_buffer.end ()));
+	ASSERT_EQ (*publish.to_bytes (), publish_buffer.to_bytes ());
+
+	nano::confirm_ack confirm_ack{ nano::dev::network_params.network, received_vote, true };
+	auto confirm_ack_buffer = confirm_ack.to_shared_const_buffer ();
+	ASSERT_EQ (2, std::distance (confirm_ack_buffer.begin (), confirm_ack_buffer.end ()));
+	ASSERT_EQ (*confirm_ack.to_bytes (), confirm_ack_buffer.to_bytes ());
+
+	// Copies are made to be modified and do not share the bytes
+	ASSERT_EQ (nullptr, received_block->clone ()->wire_bytes ());
+	ASSERT_EQ (nullptr, std::make_shared<nano::vote> (*received_vote)->wire_bytes ());
+
+	// Modifying a block drops the bytes it was received with
+	auto modified = received_block->clone ();
+	modified->wire_bytes_set (received_block->wire_bytes ());
+	modified->block_work_set (modified->block_work () + 1);
+	ASSERT_EQ (nullptr, modified->wire_bytes ());
+	modified->wire_bytes_set (received_block->wire_bytes ());
+	modified->signature_set (nano::signature{ 0 });
+	ASSERT_EQ (nullptr, modified->wire_bytes ());
+}
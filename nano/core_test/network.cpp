@@ -1,4 +1,5 @@
 #include <nano/lib/blocks.hpp>
+#include <nano/lib/thread_runner.hpp>
 #include <nano/node/election.hpp>
 #include <nano/node/network.hpp>
 #include <nano/node/nodeconfig.hpp>
@@ -10,6 +11,7 @@
 #include <nano/node/transport/tcp_socket.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
+#include <nano/test_common/chains.hpp>
 #include <nano/test_common/network.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
@@ -60,6 +62,44 @@ TEST (network, tcp_connection)
 	ASSERT_EQ (0, message2.size ());
 }
 
+// Connections pinned to dedicated io_contexts must behave like connections on the shared one
+TEST (network, connection_io_threads)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.connection_io_threads = 2;
+	auto & node1 = *system.add_node (config);
+	config.peering_port = system.get_available_port ();
+	auto & node2 = *system.add_node (config);
+	ASSERT_NE (nullptr, node1.connection_io_pool);
+	ASSERT_EQ (2, node1.connection_io_pool->size ());
+	ASSERT_TIMELY (5s, node1.network.size () == 1 && node2.network.size () == 1);
+	// Connections are served by the pool, not by the node's shared io_context
+	for (auto * node : { &node1, &node2 })
+	{
+		auto const sockets = node->tcp_listener.sockets ();
+		ASSERT_FALSE (sockets.empty ());
+		for (auto const & socket : sockets)
+		{
+			ASSERT_NE (&node->io_ctx, &socket->context ());
+		}
+	}
+
+	nano::keypair key;
+	nano::state_block_builder builder;
+	auto send = builder.make_block ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*system.work.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, node1.process_local (send).value ());
+	ASSERT_TIMELY (5s, node2.block (send->hash ()) != nullptr);
+}
+
 TEST (network, construction_with_specified_port)
 {
 	nano::test::system system{};
@@ -771,6 +811,114 @@ TEST (network, duplicate_vote_detection)
 	ASSERT_TIMELY_EQ (2s, node1.stats.count (nano::stat::type::filter, nano::stat::detail::duplicate_confirm_ack_message), 1);
 }
 
+// Flooding serializes the vote once and sends the same buffer to every peer
+TEST (network, flood_vote_shared_buffer)
+{
+	nano::test::system system;
+	auto & node0 = *system.add_node ();
+	auto & node1 = *system.add_node ();
+	auto & node2 = *system.add_node ();
+	auto & node3 = *system.add_node ();
+	ASSERT_TIMELY_EQ (5s, node0.network.size (), 3);
+
+	auto vote = nano::test::make_vote (nano::dev::genesis_key, { nano::dev::genesis->hash () });
+	// Scale the fanout so all peers are included
+	node0.network.flood_vote (vote, 2.0f);
+
+	ASSERT_TIMELY_EQ (5s, node0.stats.count (nano::stat::type::message, nano::stat::detail::confirm_ack, nano::stat::dir::out), 3);
+	for (auto node : { &node1, &node2, &node3 })
+	{
+		ASSERT_TIMELY_EQ (5s, node->stats.count (nano::stat::type::message, nano::stat::detail::confirm_ack, nano::stat::dir::in), 1);
+	}
+}
+
+namespace
+{
+/**
+ * Channel that keeps the buffers sent through it, used to check that a flood serializes a message once
+ */
+class buffer_recording_channel final : public nano::transport::channel
+{
+public:
+	explicit buffer_recording_channel (nano::node & node_a) :
+		nano::transport::channel{ node_a }
+	{
+	}
+
+	void send_buffer (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code const &, std::size_t)> const &, nano::transport::buffer_drop_policy, nano::transport::traffic_type) override
+	{
+		nano::lock_guard<nano::mutex> guard{ buffers_mutex };
+		buffers.push_back (buffer_a);
+	}
+
+	std::vector<nano::shared_const_buffer> sent () const
+	{
+		nano::lock_guard<nano::mutex> guard{ buffers_mutex };
+		return buffers;
+	}
+
+	void close () override
+	{
+	}
+
+	nano::endpoint get_remote_endpoint () const override
+	{
+		return {};
+	}
+
+	nano::endpoint get_local_endpoint () const override
+	{
+		return {};
+	}
+
+	std::string to_string () const override
+	{
+		return "buffer_recording";
+	}
+
+	nano::transport::transport_type get_type () const override
+	{
+		return nano::transport::transport_type::fake;
+	}
+
+private:
+	mutable nano::mutex buffers_mutex;
+	std::vector<nano::shared_const_buffer> buffers;
+};
+}
+
+// Every principal representative receives the same serialized buffer
+TEST (network, flood_vote_pr_buffer_identity)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	std::vector<std::shared_ptr<buffer_recording_channel>> channels;
+	for (int i = 0; i < 3; ++i)
+	{
+		auto rep = nano::test::setup_rep (system, node, nano::dev::constants.genesis_amount / 10);
+		auto channel = std::make_shared<buffer_recording_channel> (node);
+		node.rep_crawler.force_add_rep (rep.pub, channel);
+		channels.push_back (channel);
+	}
+	ASSERT_EQ (3, node.rep_crawler.principal_representatives ().size ());
+
+	auto vote = nano::test::make_vote (nano::dev::genesis_key, { nano::dev::genesis->hash () });
+	node.network.flood_vote_pr (vote);
+
+	std::vector<void const *> data;
+	for (auto const & channel : channels)
+	{
+		auto sent = channel->sent ();
+		ASSERT_EQ (1, sent.size ());
+		nano::confirm_ack message{ nano::dev::network_params.network, vote };
+		ASSERT_EQ (*message.to_bytes (), sent.front ().to_bytes ());
+		data.push_back (sent.front ().begin ()->data ());
+	}
+	// Serialized once, all channels point at the same bytes
+	ASSERT_EQ (data[0], data[1]);
+	ASSERT_EQ (data[0], data[2]);
+}
+
 // Ensures that the filter doesn't filter out votes that could not be queued for processing
 TEST (network, duplicate_revert_vote)
 {
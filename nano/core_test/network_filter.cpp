@@ -1,3 +1,4 @@
+#include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/network_filter.hpp>
 #include <nano/lib/stream.hpp>
@@ -165,3 +166,46 @@ TEST (network_filter, expire)
 	ASSERT_FALSE (filter.check (2)); // Entry with epoch 1 should be expired
 	ASSERT_FALSE (filter.apply (2)); // Entry with epoch 1 should be replaced
 }
+
+TEST (network_filter, apply_many)
+{
+	// Much larger than the number of digests so batches mostly touch distinct elements
+	auto const size = 64 * 1024;
+	nano::network_filter filter{ size };
+	// Digests applied one at a time to a filter of the same size give the expected results, including for colliding digests
+	nano::network_filter reference{ size };
+	std::vector<nano::network_filter::digest_t> digests;
+	for (auto i = 0; i < 256; ++i)
+	{
+		digests.push_back (nano::random_pool::generate<nano::uint128_union> ().number ());
+	}
+	// Duplicates within a batch see the earlier copy
+	digests.push_back (digests[1]);
+	ASSERT_FALSE (filter.apply (digests[0]));
+	ASSERT_FALSE (reference.apply (digests[0]));
+
+	auto existed = filter.apply (digests);
+	ASSERT_EQ (digests.size (), existed.size ());
+	for (std::size_t i = 0; i < digests.size (); ++i)
+	{
+		ASSERT_EQ (reference.apply (digests[i]), existed[i]);
+	}
+	ASSERT_TRUE (existed[0]);
+	for (auto const & digest : digests)
+	{
+		ASSERT_EQ (reference.check (digest), filter.check (digest));
+	}
+
+	filter.clear (digests);
+	for (auto const & digest : digests)
+	{
+		ASSERT_FALSE (filter.check (digest));
+	}
+
+	// Digests colliding on the same element are applied in order
+	nano::network_filter small{ 1 };
+	auto existed_small = small.apply (std::vector<nano::network_filter::digest_t>{ 1, 1, 2 });
+	ASSERT_EQ ((std::vector<bool>{ false, true, false }), existed_small);
+	ASSERT_FALSE (small.check (1));
+	ASSERT_TRUE (small.check (2));
+}
@@ -418,7 +418,7 @@ TEST (socket, concurrent_writes)
 	accept_callback_t accept_callback = [&] (boost::system::error_code const & ec, boost::asio::ip::tcp::socket socket) {
 		if (!ec)
 		{
-			auto new_connection = std::make_shared<nano::transport::tcp_socket> (*node, std::move (socket), socket.remote_endpoint (), socket.local_endpoint ());
+			auto new_connection = std::make_shared<nano::transport::tcp_socket> (*node, node->io_ctx, std::move (socket), socket.remote_endpoint (), socket.local_endpoint ());
 			connections.push_back (new_connection);
 			reader (new_connection);
 
@@ -476,6 +476,43 @@ TEST (socket, concurrent_writes)
 	}
 }
 
+/*
+ * Queued messages are gathered into batches bounded by count and bytes, higher priority traffic first
+ */
+TEST (socket_queue, pop_batch)
+{
+	nano::transport::socket_queue queue{ 128 };
+	auto buffer = [] (std::size_t size, uint8_t fill) {
+		return nano::shared_const_buffer{ std::vector<uint8_t> (size, fill) };
+	};
+	ASSERT_TRUE (queue.insert (buffer (100, 1), nullptr, nano::transport::traffic_type::bootstrap));
+	ASSERT_TRUE (queue.insert (buffer (100, 2), nullptr, nano::transport::traffic_type::generic));
+	ASSERT_TRUE (queue.insert (buffer (100, 3), nullptr, nano::transport::traffic_type::generic));
+	ASSERT_TRUE (queue.insert (buffer (1000, 4), nullptr, nano::transport::traffic_type::generic));
+
+	auto first_byte = [] (nano::transport::socket_queue::entry const & entry) {
+		return entry.buffer.to_bytes ().front ();
+	};
+
+	// Bounded by bytes, generic traffic first
+	auto batch1 = queue.pop (16, 250);
+	ASSERT_EQ (2, batch1.size ());
+	ASSERT_EQ (2, first_byte (batch1[0]));
+	ASSERT_EQ (3, first_byte (batch1[1]));
+
+	// A message larger than the byte limit is still sent on its own
+	auto batch2 = queue.pop (16, 250);
+	ASSERT_EQ (1, batch2.size ());
+	ASSERT_EQ (4, first_byte (batch2[0]));
+
+	auto batch3 = queue.pop (16, 250);
+	ASSERT_EQ (1, batch3.size ());
+	ASSERT_EQ (1, first_byte (batch3[0]));
+
+	ASSERT_TRUE (queue.pop (16, 250).empty ());
+	ASSERT_TRUE (queue.empty ());
+}
+
 /**
  * Check that the socket correctly handles a tcp_io_timeout during tcp connect
  * Steps:
@@ -167,11 +167,13 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.bootstrap_serving_threads, defaults.node.bootstrap_serving_threads);
 	ASSERT_EQ (conf.node.bootstrap_frontier_request_count, defaults.node.bootstrap_frontier_request_count);
 	ASSERT_EQ (conf.node.bootstrap_fraction_numerator, defaults.node.bootstrap_fraction_numerator);
+	ASSERT_EQ (conf.node.cache_snapshot_interval, defaults.node.cache_snapshot_interval);
 	ASSERT_EQ (conf.node.confirming_set_batch_time, defaults.node.confirming_set_batch_time);
 	ASSERT_EQ (conf.node.enable_voting, defaults.node.enable_voting);
 	ASSERT_EQ (conf.node.external_address, defaults.node.external_address);
 	ASSERT_EQ (conf.node.external_port, defaults.node.external_port);
 	ASSERT_EQ (conf.node.io_threads, defaults.node.io_threads);
+	ASSERT_EQ (conf.node.connection_io_threads, defaults.node.connection_io_threads);
 	ASSERT_EQ (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_EQ (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_EQ (conf.node.background_threads, defaults.node.background_threads);
@@ -197,6 +199,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.max_queued_requests, defaults.node.max_queued_requests);
 	ASSERT_EQ (conf.node.request_aggregator_threads, defaults.node.request_aggregator_threads);
 	ASSERT_EQ (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_EQ (conf.node.max_unchecked_memory, defaults.node.max_unchecked_memory);
 	ASSERT_EQ (conf.node.backlog_population.enable, defaults.node.backlog_population.enable);
 	ASSERT_EQ (conf.node.backlog_population.batch_size, defaults.node.backlog_population.batch_size);
 	ASSERT_EQ (conf.node.backlog_population.frequency, defaults.node.backlog_population.frequency);
@@ -243,6 +246,9 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_EQ (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_EQ (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_EQ (conf.node.rocksdb_config.compress_blocks, defaults.node.rocksdb_config.compress_blocks);
+	ASSERT_EQ (conf.node.rocksdb_config.pending_prefix_filter, defaults.node.rocksdb_config.pending_prefix_filter);
+	ASSERT_EQ (conf.node.rocksdb_config.partitioned_filters, defaults.node.rocksdb_config.partitioned_filters);
 
 	ASSERT_EQ (conf.node.optimistic_scheduler.enable, defaults.node.optimistic_scheduler.enable);
 	ASSERT_EQ (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -256,12 +262,16 @@ TEST (toml, daemon_config_deserialize_defaults)
 
 	ASSERT_EQ (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_EQ (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
+	ASSERT_EQ (conf.node.vote_cache.max_memory, defaults.node.vote_cache.max_memory);
+
+	ASSERT_EQ (conf.node.block_cache.max_size, defaults.node.block_cache.max_size);
 
 	ASSERT_EQ (conf.node.block_processor.max_peer_queue, defaults.node.block_processor.max_peer_queue);
 	ASSERT_EQ (conf.node.block_processor.max_system_queue, defaults.node.block_processor.max_system_queue);
 	ASSERT_EQ (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_EQ (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_EQ (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_EQ (conf.node.block_processor.verification_threads, defaults.node.block_processor.verification_threads);
 
 	ASSERT_EQ (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_EQ (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
@@ -432,11 +442,13 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	bootstrap_serving_threads = 999
 	bootstrap_frontier_request_count = 9999
 	bootstrap_fraction_numerator = 999
+	cache_snapshot_interval = 999
 	confirming_set_batch_time = 999
 	enable_voting = false
 	external_address = "0:0:0:0:0:ffff:7f01:101"
 	external_port = 999
 	io_threads = 999
+	connection_io_threads = 999
 	lmdb_max_dbs = 999
 	network_threads = 999
 	background_threads = 999
@@ -462,6 +474,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	max_queued_requests = 999
 	request_aggregator_threads = 999
 	max_unchecked_blocks = 999
+	max_unchecked_memory = 999
 	frontiers_confirmation = "always"
 	enable_upnp = false
 
@@ -476,6 +489,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	priority_live = 999
 	priority_bootstrap = 999
 	priority_local = 999
+	verification_threads = 999
 
 	[node.active_elections]
 	size = 999
@@ -580,6 +594,9 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	io_threads = 99
 	read_cache = 99
 	write_cache = 99
+	compress_blocks = false
+	pending_prefix_filter = false
+	partitioned_filters = false
 
 	[node.experimental]
 	secondary_work_peers = ["dev.org:998"]
@@ -589,6 +606,10 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	[node.vote_cache]
 	max_size = 999
 	max_voters = 999
+	max_memory = 999
+
+	[node.block_cache]
+	max_size = 999
 
 	[node.vote_processor]
 	max_pr_queue = 999
@@ -672,13 +693,16 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.bootstrap_serving_threads, defaults.node.bootstrap_serving_threads);
 	ASSERT_NE (conf.node.bootstrap_frontier_request_count, defaults.node.bootstrap_frontier_request_count);
 	ASSERT_NE (conf.node.bootstrap_fraction_numerator, defaults.node.bootstrap_fraction_numerator);
+	ASSERT_NE (conf.node.cache_snapshot_interval, defaults.node.cache_snapshot_interval);
 	ASSERT_NE (conf.node.confirming_set_batch_time, defaults.node.confirming_set_batch_time);
 	ASSERT_NE (conf.node.enable_voting, defaults.node.enable_voting);
 	ASSERT_NE (conf.node.external_address, defaults.node.external_address);
 	ASSERT_NE (conf.node.external_port, defaults.node.external_port);
 	ASSERT_NE (conf.node.io_threads, defaults.node.io_threads);
+	ASSERT_NE (conf.node.connection_io_threads, defaults.node.connection_io_threads);
 	ASSERT_NE (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_NE (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
+	ASSERT_NE (conf.node.max_unchecked_memory, defaults.node.max_unchecked_memory);
 	ASSERT_NE (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_NE (conf.node.background_threads, defaults.node.background_threads);
 	ASSERT_NE (conf.node.secondary_work_peers, defaults.node.secondary_work_peers);
@@ -751,6 +775,10 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_NE (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_NE (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_FALSE (conf.node.rocksdb_config.compress_blocks);
+	ASSERT_EQ (nano::rocksdb_config::zstd_supported (), defaults.node.rocksdb_config.compress_blocks);
+	ASSERT_NE (conf.node.rocksdb_config.pending_prefix_filter, defaults.node.rocksdb_config.pending_prefix_filter);
+	ASSERT_NE (conf.node.rocksdb_config.partitioned_filters, defaults.node.rocksdb_config.partitioned_filters);
 
 	ASSERT_NE (conf.node.optimistic_scheduler.enable, defaults.node.optimistic_scheduler.enable);
 	ASSERT_NE (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -764,12 +792,16 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 
 	ASSERT_NE (conf.node.vote_cache.max_size, defaults.node.vote_cache.max_size);
 	ASSERT_NE (conf.node.vote_cache.max_voters, defaults.node.vote_cache.max_voters);
+	ASSERT_NE (conf.node.vote_cache.max_memory, defaults.node.vote_cache.max_memory);
+
+	ASSERT_NE (conf.node.block_cache.max_size, defaults.node.block_cache.max_size);
 
 	ASSERT_NE (conf.node.block_processor.max_peer_queue, defaults.node.block_processor.max_peer_queue);
 	ASSERT_NE (conf.node.block_processor.max_system_queue, defaults.node.block_processor.max_system_queue);
 	ASSERT_NE (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_NE (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_NE (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_NE (conf.node.block_processor.verification_threads, defaults.node.block_processor.verification_threads);
 
 	ASSERT_NE (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_NE (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
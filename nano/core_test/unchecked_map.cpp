@@ -280,3 +280,69 @@ TEST (unchecked, multiple_get)
 	auto unchecked5 = unchecked.get (block2->hash ());
 	ASSERT_EQ (unchecked5.size (), 0);
 }
+
+// Once the memory budget is exceeded the oldest entries are evicted first, regardless of which shard holds them
+TEST (unchecked, evict_memory)
+{
+	nano::test::system system{};
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	nano::block_builder builder;
+	for (int i = 0; i < 64; ++i)
+	{
+		blocks.push_back (builder
+						  .send ()
+						  .previous (i + 1)
+						  .destination (1)
+						  .balance (2)
+						  .sign (nano::keypair ().prv, 4)
+						  .work (5)
+						  .build ());
+	}
+	auto const entry_size = nano::unchecked_map::entry_size (nano::unchecked_info{ blocks.front () });
+	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false, entry_size * 16 };
+	for (auto const & block : blocks)
+	{
+		unchecked.put (block->previous (), nano::unchecked_info{ block });
+	}
+	ASSERT_EQ (16, unchecked.count ());
+	ASSERT_EQ (entry_size * 16, unchecked.memory ());
+	ASSERT_EQ (48, system.stats.count (nano::stat::type::unchecked, nano::stat::detail::evicted));
+	for (std::size_t i = 0; i < blocks.size (); ++i)
+	{
+		ASSERT_EQ (i >= 48, unchecked.exists (nano::unchecked_key{ blocks[i]->previous (), blocks[i]->hash () }));
+	}
+}
+
+// Triggered dependencies notify every waiting block and remove it from the map
+TEST (unchecked, trigger)
+{
+	nano::test::system system{};
+	nano::unchecked_map unchecked{ max_unchecked_blocks, system.stats, false };
+	unchecked.start ();
+	std::atomic<int> satisfied{ 0 };
+	unchecked.satisfied.add ([&satisfied] (nano::unchecked_info const &) {
+		++satisfied;
+	});
+	nano::block_builder builder;
+	for (int i = 0; i < 32; ++i)
+	{
+		auto block = builder
+					 .send ()
+					 .previous (i % 4 + 1)
+					 .destination (1)
+					 .balance (i)
+					 .sign (nano::keypair ().prv, 4)
+					 .work (5)
+					 .build ();
+		unchecked.put (block->previous (), nano::unchecked_info{ block });
+	}
+	ASSERT_EQ (32, unchecked.count ());
+	for (int i = 0; i < 4; ++i)
+	{
+		unchecked.trigger (nano::block_hash (i + 1));
+	}
+	ASSERT_TIMELY_EQ (5s, 32, satisfied);
+	ASSERT_EQ (0, unchecked.count ());
+	ASSERT_EQ (0, unchecked.memory ());
+	unchecked.stop ();
+}
@@ -0,0 +1,36 @@
+#include <nano/lib/versioned_snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST (versioned_snapshot, publish)
+{
+	nano::versioned_snapshot<int> snapshot{ std::make_shared<int> (1) };
+	auto const first = snapshot.get ();
+	ASSERT_EQ (1, *first);
+	snapshot.publish (std::make_shared<int> (2));
+	ASSERT_EQ (2, *snapshot.get ());
+	// Readers holding the previous value keep it alive
+	ASSERT_EQ (1, *first);
+	// Other threads pick up the latest value as well
+	int seen{ 0 };
+	std::thread reader ([&snapshot, &seen] () {
+		seen = *snapshot.get ();
+	});
+	reader.join ();
+	ASSERT_EQ (2, seen);
+}
+
+// Instances of the same type share the thread local cache without mixing up their values
+TEST (versioned_snapshot, instances)
+{
+	nano::versioned_snapshot<int> snapshot1{ std::make_shared<int> (1) };
+	nano::versioned_snapshot<int> snapshot2{ std::make_shared<int> (2) };
+	ASSERT_EQ (1, *snapshot1.get ());
+	ASSERT_EQ (2, *snapshot2.get ());
+	ASSERT_EQ (1, *snapshot1.get ());
+	snapshot2.publish (std::make_shared<int> (3));
+	ASSERT_EQ (1, *snapshot1.get ());
+	ASSERT_EQ (3, *snapshot2.get ());
+}
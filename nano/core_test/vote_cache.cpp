@@ -367,4 +367,42 @@ TEST (vote_cache, age_cutoff)
 
 	// After 3 seconds the entry should be removed
 	ASSERT_TIMELY (5s, vote_cache.top (0).empty ());
-}
\ No newline at end of file
+}
+
+/*
+ * Ensure the memory budget is enforced by removing the oldest entries first
+ */
+TEST (vote_cache, overfill_memory)
+{
+	nano::test::system system;
+	nano::vote_cache_config cfg;
+	nano::vote_cache vote_cache{ cfg, system.stats };
+	vote_cache.rep_weight_query = rep_weight_query ();
+
+	// Measure a single entry to size the memory budget
+	auto rep1 = create_rep (9);
+	vote_cache.insert (nano::test::make_vote (rep1, { nano::test::random_hash () }, 1024 * 1024));
+	auto const entry_memory = vote_cache.memory ();
+	ASSERT_GT (entry_memory, 0);
+	vote_cache.clear ();
+	ASSERT_EQ (0, vote_cache.memory ());
+
+	cfg.max_memory = entry_memory * 16;
+	std::vector<nano::block_hash> hashes;
+	for (int n = 0; n < 64; ++n)
+	{
+		hashes.push_back (nano::test::random_hash ());
+		vote_cache.insert (nano::test::make_vote (rep1, { hashes.back () }, 1024 * 1024));
+	}
+	ASSERT_EQ (16, vote_cache.size ());
+	ASSERT_LE (vote_cache.memory (), cfg.max_memory);
+	ASSERT_TRUE (vote_cache.find (hashes.front ()).empty ());
+	ASSERT_FALSE (vote_cache.find (hashes.back ()).empty ());
+
+	// Erasing entries releases their memory
+	for (auto const & hash : hashes)
+	{
+		vote_cache.erase (hash);
+	}
+	ASSERT_EQ (0, vote_cache.memory ());
+}
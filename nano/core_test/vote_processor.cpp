@@ -79,6 +79,37 @@ TEST (vote_processor, invalid_signature)
 	ASSERT_TIMELY_EQ (5s, 2, election->votes ().size ());
 }
 
+// Invalid votes processed in the same batch must not affect valid ones
+TEST (vote_processor, invalid_signature_batch)
+{
+	nano::test::system system{ 1 };
+	auto & node = *system.nodes[0];
+	auto chain = nano::test::setup_chain (system, node, 1, nano::dev::genesis_key, false);
+	auto channel = std::make_shared<nano::transport::inproc::channel> (node, node);
+
+	auto election = nano::test::start_election (system, node, chain[0]->hash ());
+	ASSERT_NE (election, nullptr);
+	ASSERT_EQ (1, election->votes ().size ());
+
+	size_t const count = 16;
+	std::vector<std::shared_ptr<nano::vote>> valid_votes;
+	for (size_t i = 0; i < count; ++i)
+	{
+		nano::keypair key;
+		auto vote = nano::test::make_vote (key, { chain[0] }, nano::vote::timestamp_min * 1, 0);
+		auto vote_invalid = std::make_shared<nano::vote> (*vote);
+		vote_invalid->signature.bytes[0] ^= 1;
+		node.vote_processor.vote (vote_invalid, channel);
+		valid_votes.push_back (vote);
+	}
+	for (auto const & vote : valid_votes)
+	{
+		node.vote_processor.vote (vote, channel);
+	}
+	ASSERT_TIMELY_EQ (5s, 1 + count, election->votes ().size ());
+	ASSERT_TIMELY_EQ (5s, count, node.stats.count (nano::stat::type::vote, nano::stat::detail::invalid));
+}
+
 TEST (vote_processor, overflow)
 {
 	nano::test::system system;
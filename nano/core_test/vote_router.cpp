@@ -0,0 +1,80 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/node/election.hpp>
+#include <nano/node/vote_router.hpp>
+#include <nano/test_common/chains.hpp>
+#include <nano/test_common/system.hpp>
+#include <nano/test_common/testutil.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+// Routes must survive the routing table being rebuilt when it fills up
+TEST (vote_router, connect_many)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	auto blocks = nano::test::setup_chain (system, node, 1, nano::dev::genesis_key, false);
+	auto election = nano::test::start_election (system, node, blocks.front ()->hash ());
+	ASSERT_NE (nullptr, election);
+
+	std::vector<nano::block_hash> hashes;
+	for (auto i = 0; i < 5000; ++i)
+	{
+		hashes.push_back (nano::test::random_hash ());
+		node.vote_router.connect (hashes.back (), election);
+	}
+	for (auto const & hash : hashes)
+	{
+		ASSERT_EQ (election, node.vote_router.election (hash));
+	}
+	for (std::size_t i = 0; i < hashes.size (); i += 2)
+	{
+		node.vote_router.disconnect (hashes[i]);
+	}
+	for (std::size_t i = 0; i < hashes.size (); ++i)
+	{
+		ASSERT_EQ (i % 2 != 0, node.vote_router.active (hashes[i]));
+	}
+	ASSERT_TRUE (node.vote_router.active (blocks.front ()->hash ()));
+}
+
+// Routes to elections that no longer exist must not resolve
+TEST (vote_router, expired)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	auto hash = nano::test::random_hash ();
+	{
+		auto blocks = nano::test::setup_chain (system, node, 1, nano::dev::genesis_key, false);
+		auto election = nano::test::start_election (system, node, blocks.front ()->hash ());
+		ASSERT_NE (nullptr, election);
+		node.vote_router.connect (hash, election);
+		ASSERT_TRUE (node.vote_router.active (hash));
+		node.active.erase (*blocks.front ());
+	}
+	ASSERT_TIMELY (5s, !node.vote_router.active (hash));
+	ASSERT_EQ (nullptr, node.vote_router.election (hash));
+}
+
+// Replacing the route of a hash many times rebuilds the table without losing the other routes
+TEST (vote_router, reconnect_many)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	auto blocks = nano::test::setup_chain (system, node, 2, nano::dev::genesis_key, false);
+	auto election1 = nano::test::start_election (system, node, blocks[0]->hash ());
+	auto election2 = nano::test::start_election (system, node, blocks[1]->hash ());
+	ASSERT_NE (nullptr, election1);
+	ASSERT_NE (nullptr, election2);
+
+	auto const hash = nano::test::random_hash ();
+	for (auto i = 0; i < 5000; ++i)
+	{
+		auto const & election = i % 2 == 0 ? election1 : election2;
+		node.vote_router.connect (hash, election);
+		ASSERT_EQ (election, node.vote_router.election (hash));
+	}
+	ASSERT_EQ (election1, node.vote_router.election (blocks[0]->hash ()));
+	ASSERT_EQ (election2, node.vote_router.election (blocks[1]->hash ()));
+}
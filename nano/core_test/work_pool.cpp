@@ -3,6 +3,7 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/lib/work.hpp>
+#include <nano/lib/work_engine.hpp>
 #include <nano/lib/work_version.hpp>
 #include <nano/node/openclconfig.hpp>
 #include <nano/node/openclwork.hpp>
@@ -201,3 +202,45 @@ TEST (work, eco_pow)
 	// It's possible under some unlucky circumstances that this fails to the random nature of valid work generation.
 	ASSERT_LT (future1.get (), future2.get ());
 }
+
+// check that every work engine supported by this CPU computes the same work values as the reference blake2b implementation
+TEST (work, engines)
+{
+	auto engines = nano::work_engine::available ();
+	ASSERT_FALSE (engines.empty ());
+	ASSERT_EQ (nano::work_engine_type::scalar, engines.front ());
+	ASSERT_EQ (engines.back (), nano::work_engine::best ());
+	for (auto type : engines)
+	{
+		nano::work_engine engine{ type };
+		ASSERT_EQ (type, engine.type ());
+		ASSERT_LE (engine.lanes (), nano::work_engine::max_lanes);
+		for (auto i (0); i < 16; ++i)
+		{
+			nano::root root;
+			nano::random_pool::generate_block (root.bytes.data (), root.bytes.size ());
+			std::array<uint64_t, nano::work_engine::max_lanes> nonces;
+			nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (nonces.data ()), nonces.size () * sizeof (uint64_t));
+			std::array<uint64_t, nano::work_engine::max_lanes> values{};
+			engine.values (root, nonces.data (), values.data ());
+			for (auto lane (0u); lane < engine.lanes (); ++lane)
+			{
+				ASSERT_EQ (nano::dev::network_params.work.value (root, nonces[lane]), values[lane]) << nano::to_string (type);
+			}
+		}
+	}
+}
+
+// generate work with each supported engine and check that it validates
+TEST (work, generate_engines)
+{
+	for (auto type : nano::work_engine::available ())
+	{
+		nano::work_pool pool{ nano::dev::network_params.network, 1, std::chrono::nanoseconds (0), nullptr, type };
+		ASSERT_EQ (type, pool.engine.type ());
+		nano::root root (1);
+		auto work = pool.generate (nano::work_version::work_1, root, nano::dev::network_params.work.base);
+		ASSERT_TRUE (work.is_initialized ());
+		ASSERT_GE (nano::dev::network_params.work.difficulty (nano::work_version::work_1, root, *work), nano::dev::network_params.work.base);
+	}
+}
@@ -2,13 +2,13 @@
 
 nano::shared_const_buffer::shared_const_buffer (std::vector<uint8_t> const & data) :
 	m_data (std::make_shared<std::vector<uint8_t>> (data)),
-	m_buffer (boost::asio::buffer (*m_data))
+	m_buffers{ boost::asio::buffer (*m_data) }
 {
 }
 
 nano::shared_const_buffer::shared_const_buffer (std::vector<uint8_t> && data) :
 	m_data (std::make_shared<std::vector<uint8_t>> (std::move (data))),
-	m_buffer (boost::asio::buffer (*m_data))
+	m_buffers{ boost::asio::buffer (*m_data) }
 {
 }
 
@@ -19,29 +19,37 @@ nano::shared_const_buffer::shared_const_buffer (uint8_t data) :
 
 nano::shared_const_buffer::shared_const_buffer (std::string const & data) :
 	m_data (std::make_shared<std::vector<uint8_t>> (data.begin (), data.end ())),
-	m_buffer (boost::asio::buffer (*m_data))
+	m_buffers{ boost::asio::buffer (*m_data) }
 {
 }
 
 nano::shared_const_buffer::shared_const_buffer (std::shared_ptr<std::vector<uint8_t>> const & data) :
 	m_data (data),
-	m_buffer (boost::asio::buffer (*m_data))
+	m_buffers{ boost::asio::buffer (*m_data) }
+{
+}
+
+nano::shared_const_buffer::shared_const_buffer (std::vector<uint8_t> && data, std::shared_ptr<std::vector<uint8_t> const> const & payload) :
+	m_data (std::make_shared<std::vector<uint8_t>> (std::move (data))),
+	m_payload (payload),
+	m_buffers{ boost::asio::buffer (*m_data), boost::asio::buffer (*m_payload) },
+	m_count (2)
 {
 }
 
 boost::asio::const_buffer const * nano::shared_const_buffer::begin () const
 {
-	return &m_buffer;
+	return m_buffers.data ();
 }
 
 boost::asio::const_buffer const * nano::shared_const_buffer::end () const
 {
-	return &m_buffer + 1;
+	return m_buffers.data () + m_count;
 }
 
 std::size_t nano::shared_const_buffer::size () const
 {
-	return m_buffer.size ();
+	return boost::asio::buffer_size (*this);
 }
 
 std::vector<uint8_t> nano::shared_const_buffer::to_bytes () const
@@ -2,6 +2,8 @@
 
 #include <nano/boost/asio/write.hpp>
 
+#include <array>
+
 namespace nano
 {
 class shared_const_buffer
@@ -15,6 +17,8 @@ public:
 	explicit shared_const_buffer (std::string const & data);
 	explicit shared_const_buffer (std::vector<uint8_t> && data);
 	explicit shared_const_buffer (std::shared_ptr<std::vector<uint8_t>> const & data);
+	/** Gathers `data' followed by a shared `payload' without copying the payload */
+	shared_const_buffer (std::vector<uint8_t> && data, std::shared_ptr<std::vector<uint8_t> const> const & payload);
 
 	boost::asio::const_buffer const * begin () const;
 	boost::asio::const_buffer const * end () const;
@@ -24,7 +28,9 @@ public:
 
 private:
 	std::shared_ptr<std::vector<uint8_t>> m_data;
-	boost::asio::const_buffer m_buffer;
+	std::shared_ptr<std::vector<uint8_t> const> m_payload;
+	std::array<boost::asio::const_buffer, 2> m_buffers;
+	std::size_t m_count{ 1 };
 };
 
 static_assert (boost::asio::is_const_buffer_sequence<shared_const_buffer>::value, "Not ConstBufferSequence compliant");
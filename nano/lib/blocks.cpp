@@ -117,6 +117,32 @@ void nano::block::refresh ()
 	{
 		cached_hash = generate_hash ();
 	}
+	wire_bytes_m.set (nullptr);
+}
+
+std::shared_ptr<std::vector<uint8_t> const> nano::block::wire_bytes () const
+{
+	auto result = wire_bytes_m.get ();
+#ifndef NDEBUG
+	if (result)
+	{
+		// Once a block is created, it should not be modified (unless using refresh ())
+		// This would make the cached bytes stale; check they still match.
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			serialize (stream);
+		}
+		debug_assert (*result == bytes);
+	}
+#endif
+	return result;
+}
+
+void nano::block::wire_bytes_set (std::shared_ptr<std::vector<uint8_t> const> const & bytes_a)
+{
+	debug_assert (bytes_a == nullptr || bytes_a->size () == size (type ()));
+	wire_bytes_m.set (bytes_a);
 }
 
 bool nano::block::is_send () const noexcept
@@ -376,6 +402,7 @@ uint64_t nano::send_block::block_work () const
 void nano::send_block::block_work_set (uint64_t work_a)
 {
 	work = work_a;
+	wire_bytes_m.set (nullptr);
 }
 
 nano::send_hashables::send_hashables (nano::block_hash const & previous_a, nano::account const & destination_a, nano::amount const & balance_a) :
@@ -636,6 +663,7 @@ nano::signature const & nano::send_block::block_signature () const
 void nano::send_block::signature_set (nano::signature const & signature_a)
 {
 	signature = signature_a;
+	wire_bytes_m.set (nullptr);
 }
 
 void nano::send_block::operator() (nano::object_stream & obs) const
@@ -781,6 +809,7 @@ uint64_t nano::open_block::block_work () const
 void nano::open_block::block_work_set (uint64_t work_a)
 {
 	work = work_a;
+	wire_bytes_m.set (nullptr);
 }
 
 std::optional<nano::block_hash> nano::open_block::previous_field () const
@@ -931,6 +960,7 @@ nano::signature const & nano::open_block::block_signature () const
 void nano::open_block::signature_set (nano::signature const & signature_a)
 {
 	signature = signature_a;
+	wire_bytes_m.set (nullptr);
 }
 
 void nano::open_block::operator() (nano::object_stream & obs) const
@@ -1057,6 +1087,7 @@ uint64_t nano::change_block::block_work () const
 void nano::change_block::block_work_set (uint64_t work_a)
 {
 	work = work_a;
+	wire_bytes_m.set (nullptr);
 }
 
 std::optional<nano::block_hash> nano::change_block::previous_field () const
@@ -1202,6 +1233,7 @@ nano::signature const & nano::change_block::block_signature () const
 void nano::change_block::signature_set (nano::signature const & signature_a)
 {
 	signature = signature_a;
+	wire_bytes_m.set (nullptr);
 }
 
 void nano::change_block::operator() (nano::object_stream & obs) const
@@ -1361,6 +1393,7 @@ uint64_t nano::state_block::block_work () const
 void nano::state_block::block_work_set (uint64_t work_a)
 {
 	work = work_a;
+	wire_bytes_m.set (nullptr);
 }
 
 std::optional<nano::block_hash> nano::state_block::previous_field () const
@@ -1541,6 +1574,7 @@ nano::signature const & nano::state_block::block_signature () const
 void nano::state_block::signature_set (nano::signature const & signature_a)
 {
 	signature = signature_a;
+	wire_bytes_m.set (nullptr);
 }
 
 void nano::state_block::operator() (nano::object_stream & obs) const
@@ -1830,6 +1864,7 @@ uint64_t nano::receive_block::block_work () const
 void nano::receive_block::block_work_set (uint64_t work_a)
 {
 	work = work_a;
+	wire_bytes_m.set (nullptr);
 }
 
 bool nano::receive_block::operator== (nano::block const & other_a) const
@@ -1878,6 +1913,7 @@ nano::signature const & nano::receive_block::block_signature () const
 void nano::receive_block::signature_set (nano::signature const & signature_a)
 {
 	signature = signature_a;
+	wire_bytes_m.set (nullptr);
 }
 
 nano::block_type nano::receive_block::type () const
@@ -6,6 +6,7 @@
 #include <nano/lib/fwd.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/optional_ptr.hpp>
+#include <nano/lib/serialized_bytes.hpp>
 
 #include <boost/property_tree/ptree_fwd.hpp>
 
@@ -53,6 +54,10 @@ public:
 	virtual std::shared_ptr<nano::block> clone () const = 0;
 	// If there are any changes to the hashables, call this to update the cached hash
 	void refresh ();
+	// Serialized block as received from the network, reused when the block is sent again. nullptr if not set
+	std::shared_ptr<std::vector<uint8_t> const> wire_bytes () const;
+	// Only call before the block is uniqued or otherwise shared, modifying the block clears the bytes again
+	void wire_bytes_set (std::shared_ptr<std::vector<uint8_t> const> const &);
 	bool is_send () const noexcept;
 	bool is_receive () const noexcept;
 	bool is_change () const noexcept;
@@ -93,6 +98,7 @@ protected:
 	 * Otherwise it may be null (for example, an old block or fork).
 	 */
 	nano::optional_ptr<nano::block_sideband> sideband_m;
+	nano::serialized_bytes wire_bytes_m;
 
 private:
 	nano::block_hash generate_hash () const;
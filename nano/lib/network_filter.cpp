@@ -5,9 +5,12 @@
 #include <nano/lib/stream.hpp>
 #include <nano/secure/common.hpp>
 
+#include <algorithm>
+
 nano::network_filter::network_filter (size_t size_a, epoch_t age_cutoff_a) :
+	age_cutoff{ age_cutoff_a },
 	items (size_a, { 0 }),
-	age_cutoff{ age_cutoff_a }
+	stripes (std::clamp<std::size_t> (size_a, 1, max_stripes))
 {
 	nano::random_pool::generate_block (key, key.size ());
 }
@@ -15,17 +18,54 @@ nano::network_filter::network_filter (size_t size_a, epoch_t age_cutoff_a) :
 void nano::network_filter::update (epoch_t epoch_inc)
 {
 	debug_assert (epoch_inc > 0);
-	nano::lock_guard<nano::mutex> lock{ mutex };
 	current_epoch += epoch_inc;
 }
 
 bool nano::network_filter::compare (entry const & existing, digest_t const & digest) const
 {
-	debug_assert (!mutex.try_lock ());
 	// Only consider digests to be the same if the epoch is within the age cutoff
 	return existing.digest == digest && existing.epoch + age_cutoff >= current_epoch;
 }
 
+std::size_t nano::network_filter::index (nano::uint128_t const & hash_a) const
+{
+	debug_assert (items.size () > 0);
+	return static_cast<std::size_t> (hash_a % items.size ());
+}
+
+std::size_t nano::network_filter::stripe_index (std::size_t index_a) const
+{
+	// Stripes cover contiguous ranges of elements
+	return index_a * stripes.size () / items.size ();
+}
+
+auto nano::network_filter::stripe_of (std::size_t index_a) const -> stripe const &
+{
+	return stripes[stripe_index (index_a)];
+}
+
+template <typename Func>
+void nano::network_filter::for_each_locked (std::vector<digest_t> const & digests, Func const & func)
+{
+	std::vector<std::pair<std::size_t, std::size_t>> positions; // <stripe, position in digests>
+	positions.reserve (digests.size ());
+	for (std::size_t i = 0; i < digests.size (); ++i)
+	{
+		positions.emplace_back (stripe_index (index (digests[i])), i);
+	}
+	std::sort (positions.begin (), positions.end ());
+
+	for (auto it = positions.begin (); it != positions.end ();)
+	{
+		auto const current = it->first;
+		nano::lock_guard<nano::mutex> lock{ stripes[current].mutex };
+		for (; it != positions.end () && it->first == current; ++it)
+		{
+			func (it->second);
+		}
+	}
+}
+
 bool nano::network_filter::apply (uint8_t const * bytes_a, size_t count_a, nano::uint128_t * digest_out)
 {
 	// Get hash before locking
@@ -39,7 +79,7 @@ bool nano::network_filter::apply (uint8_t const * bytes_a, size_t count_a, nano:
 
 bool nano::network_filter::apply (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
+	nano::lock_guard<nano::mutex> lock{ stripe_of (index (digest)).mutex };
 
 	auto & element = get_element (digest);
 	bool existed = compare (element, digest);
@@ -56,16 +96,31 @@ bool nano::network_filter::check (uint8_t const * bytes, size_t count) const
 	return check (hash (bytes, count));
 }
 
+std::vector<bool> nano::network_filter::apply (std::vector<digest_t> const & digests)
+{
+	std::vector<bool> result (digests.size ());
+	for_each_locked (digests, [&] (std::size_t position) {
+		auto const & digest = digests[position];
+		auto & element = get_element (digest);
+		result[position] = compare (element, digest);
+		if (!result[position])
+		{
+			element = { digest, current_epoch };
+		}
+	});
+	return result;
+}
+
 bool nano::network_filter::check (digest_t const & digest) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
+	nano::lock_guard<nano::mutex> lock{ stripe_of (index (digest)).mutex };
 	auto & element = get_element (digest);
 	return compare (element, digest);
 }
 
 void nano::network_filter::clear (digest_t const & digest)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
+	nano::lock_guard<nano::mutex> lock{ stripe_of (index (digest)).mutex };
 	auto & element = get_element (digest);
 	if (compare (element, digest))
 	{
@@ -75,15 +130,14 @@ void nano::network_filter::clear (digest_t const & digest)
 
 void nano::network_filter::clear (std::vector<digest_t> const & digests)
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	for (auto const & digest : digests)
-	{
+	for_each_locked (digests, [&] (std::size_t position) {
+		auto const & digest = digests[position];
 		auto & element = get_element (digest);
 		if (compare (element, digest))
 		{
 			element = { 0 };
 		}
-	}
+	});
 }
 
 void nano::network_filter::clear (uint8_t const * bytes_a, size_t count_a)
@@ -99,8 +153,15 @@ void nano::network_filter::clear (OBJECT const & object_a)
 
 void nano::network_filter::clear ()
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	items.assign (items.size (), { 0 });
+	for (std::size_t i = 0; i < items.size ();)
+	{
+		auto const & current = stripe_of (i);
+		nano::lock_guard<nano::mutex> lock{ current.mutex };
+		for (; i < items.size () && &stripe_of (i) == &current; ++i)
+		{
+			items[i] = { 0 };
+		}
+	}
 }
 
 template <typename OBJECT>
@@ -116,18 +177,16 @@ nano::uint128_t nano::network_filter::hash (OBJECT const & object_a) const
 
 auto nano::network_filter::get_element (nano::uint128_t const & hash_a) -> entry &
 {
-	debug_assert (!mutex.try_lock ());
-	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	auto const index_l = index (hash_a);
+	debug_assert (!stripe_of (index_l).mutex.try_lock ());
+	return items[index_l];
 }
 
 auto nano::network_filter::get_element (nano::uint128_t const & hash_a) const -> entry const &
 {
-	debug_assert (!mutex.try_lock ());
-	debug_assert (items.size () > 0);
-	size_t index (hash_a % items.size ());
-	return items[index];
+	auto const index_l = index (hash_a);
+	debug_assert (!stripe_of (index_l).mutex.try_lock ());
+	return items[index_l];
 }
 
 nano::uint128_t nano::network_filter::hash (uint8_t const * bytes_a, size_t count_a) const
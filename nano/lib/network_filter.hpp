@@ -7,12 +7,16 @@
 #include <cryptopp/seckey.h>
 #include <cryptopp/siphash.h>
 
+#include <atomic>
+#include <vector>
+
 namespace nano
 {
 /**
  * A probabilistic duplicate filter based on directed map caches, using SipHash 2/4/128
  * The probability of false negatives (unique packet marked as duplicate) is the probability of a 128-bit SipHash collision.
  * The probability of false positives (duplicate packet marked as unique) shrinks with a larger filter.
+ * The filter is split into contiguous stripes each guarded by its own mutex, so concurrent callers only contend when their digests land in the same stripe.
  * @note This class is thread-safe.
  */
 class network_filter final
@@ -39,6 +43,12 @@ public:
 	bool apply (uint8_t const * bytes, size_t count, digest_t * digest_out = nullptr);
 	bool apply (digest_t const & digest);
 
+	/**
+	 * Inserts many digests, locking each stripe once
+	 * @return for each digest whether it was already present in the filter, in the same order
+	 */
+	std::vector<bool> apply (std::vector<digest_t> const &);
+
 	/**
 	 * Checks if the digest is in the filter.
 	 * @return a boolean representing the existence of the hash in the filter.
@@ -84,15 +94,16 @@ public:
 	 **/
 	digest_t hash (uint8_t const * bytes, size_t count) const;
 
+	/** Upper bound on the number of stripes the filter is split into */
+	static std::size_t constexpr max_stripes = 64;
+
 private:
 	epoch_t const age_cutoff;
-	epoch_t current_epoch{ 0 };
+	std::atomic<epoch_t> current_epoch{ 0 };
 
 	using siphash_t = CryptoPP::SipHash<2, 4, true>;
 	CryptoPP::SecByteBlock key{ siphash_t::KEYLENGTH };
 
-	mutable nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
-
 private:
 	struct entry
 	{
@@ -100,16 +111,31 @@ private:
 		epoch_t epoch;
 	};
 
+	/** Aligned to a cache line so stripes locked by different threads do not share one */
+	struct alignas (64) stripe
+	{
+		mutable nano::mutex mutex{ mutex_identifier (mutexes::network_filter) };
+	};
+
 	std::vector<entry> items;
+	std::vector<stripe> stripes;
+
+	std::size_t index (digest_t const & hash) const;
+	/** Stripe guarding the element at \p index */
+	std::size_t stripe_index (std::size_t index) const;
+	stripe const & stripe_of (std::size_t index) const;
 
 	/**
 	 * Get element from digest.
-	 * @note must have a lock on mutex
+	 * @note must have a lock on the stripe of the element
 	 * @return a reference to the element with key \p hash_a
 	 **/
 	entry & get_element (digest_t const & hash);
 	entry const & get_element (digest_t const & hash) const;
 
 	bool compare (entry const & existing, digest_t const & digest) const;
+	/** Groups digests by stripe and calls \p func with each stripe locked once. \p func receives the position of the digest in \p digests */
+	template <typename Func>
+	void for_each_locked (std::vector<digest_t> const & digests, Func const & func);
 };
 }
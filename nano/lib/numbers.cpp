@@ -347,6 +347,57 @@ bool nano::validate_message (nano::public_key const & public_key, nano::uint256_
 	return validate_message (public_key, message.bytes.data (), sizeof (message.bytes), signature);
 }
 
+bool nano::validate_message_batch (unsigned char const ** messages, size_t * lengths, unsigned char const ** public_keys, unsigned char const ** signatures, size_t count, int * valid)
+{
+	// The batch verifier reduces S modulo the group order and skips the canonical S check done by ed25519_sign_open
+	// Such signatures are rejected here so batch and single verification accept exactly the same signatures
+	auto const non_canonical = [signatures] (size_t index) {
+		return (signatures[index][63] & 0xe0) != 0;
+	};
+	std::vector<size_t> canonical;
+	canonical.reserve (count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (non_canonical (i))
+		{
+			valid[i] = 0;
+		}
+		else
+		{
+			canonical.push_back (i);
+		}
+	}
+	if (canonical.size () == count)
+	{
+		return 0 != ed25519_sign_open_batch (messages, lengths, public_keys, signatures, count, valid);
+	}
+	std::vector<unsigned char const *> messages_l;
+	std::vector<size_t> lengths_l;
+	std::vector<unsigned char const *> public_keys_l;
+	std::vector<unsigned char const *> signatures_l;
+	messages_l.reserve (canonical.size ());
+	lengths_l.reserve (canonical.size ());
+	public_keys_l.reserve (canonical.size ());
+	signatures_l.reserve (canonical.size ());
+	for (auto index : canonical)
+	{
+		messages_l.push_back (messages[index]);
+		lengths_l.push_back (lengths[index]);
+		public_keys_l.push_back (public_keys[index]);
+		signatures_l.push_back (signatures[index]);
+	}
+	std::vector<int> valid_l (canonical.size (), 0);
+	if (!canonical.empty ())
+	{
+		ed25519_sign_open_batch (messages_l.data (), lengths_l.data (), public_keys_l.data (), signatures_l.data (), canonical.size (), valid_l.data ());
+	}
+	for (size_t i = 0; i < canonical.size (); ++i)
+	{
+		valid[canonical[i]] = valid_l[i];
+	}
+	return true;
+}
+
 nano::uint128_union::uint128_union (std::string const & string_a)
 {
 	auto error (decode_hex (string_a));
@@ -482,6 +482,13 @@ nano::signature sign_message (nano::raw_key const &, nano::public_key const &, n
 nano::signature sign_message (nano::raw_key const &, nano::public_key const &, uint8_t const *, size_t);
 bool validate_message (nano::public_key const &, nano::uint256_union const &, nano::signature const &);
 bool validate_message (nano::public_key const &, uint8_t const *, size_t, nano::signature const &);
+/**
+ * Validates multiple signatures at once using ed25519 batch verification, batches containing an invalid signature are rechecked individually
+ * Signatures with a non-canonical S are rejected the same way validate_message rejects them
+ * @param valid Output array, set to 1 for every valid signature and 0 otherwise
+ * @return true if any of the signatures is invalid
+ */
+bool validate_message_batch (unsigned char const ** messages, size_t * lengths, unsigned char const ** public_keys, unsigned char const ** signatures, size_t count, int * valid);
 nano::raw_key deterministic_key (nano::raw_key const &, uint32_t);
 nano::public_key pub_key (nano::raw_key const &);
 
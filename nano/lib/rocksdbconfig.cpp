@@ -6,8 +6,11 @@ nano::error nano::rocksdb_config::serialize_toml (nano::tomlconfig & toml) const
 {
 	toml.put ("enable", enable, "Whether to use the RocksDB backend for the ledger database.\ntype:bool");
 	toml.put ("io_threads", io_threads, "Number of threads to use with the background compaction and flushing.\ntype:uint32");
-	toml.put ("read_cache", read_cache, "Amount of megabytes per table allocated to read cache. Valid range is 1 - 1024. Default is 32.\nCarefully monitor memory usage if non-default values are used\ntype:long");
+	toml.put ("read_cache", read_cache, "Amount of megabytes per table allocated to the read cache shared by all tables. Valid range is 1 - 1024. Default is 32.\nCarefully monitor memory usage if non-default values are used\ntype:long");
 	toml.put ("write_cache", write_cache, "Total amount of megabytes allocated to write cache. Valid range is 1 - 256. Default is 64.\nCarefully monitor memory usage if non-default values are used\ntype:long");
+	toml.put ("compress_blocks", compress_blocks, "Compress the blocks table with ZSTD and a trained dictionary. Ignored when the node is built without ZSTD support.\nOnly newly written files are affected, existing data is compressed gradually by compaction.\ntype:bool");
+	toml.put ("pending_prefix_filter", pending_prefix_filter, "Use prefix Bloom filters on the account of pending entries to skip files when looking up receivables of an account.\ntype:bool");
+	toml.put ("partitioned_filters", partitioned_filters, "Use partitioned index and filter blocks held in the read cache for tables serving mostly point lookups.\nReduces memory used by filters of large ledgers.\ntype:bool");
 
 	return toml.get_error ();
 }
@@ -18,6 +21,9 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 	toml.get_optional<unsigned> ("io_threads", io_threads);
 	toml.get_optional<long> ("read_cache", read_cache);
 	toml.get_optional<long> ("write_cache", write_cache);
+	toml.get_optional<bool> ("compress_blocks", compress_blocks);
+	toml.get_optional<bool> ("pending_prefix_filter", pending_prefix_filter);
+	toml.get_optional<bool> ("partitioned_filters", partitioned_filters);
 
 	// Validate ranges
 	if (io_threads == 0)
@@ -28,5 +28,21 @@ public:
 	unsigned io_threads{ std::max (nano::hardware_concurrency () / 2, 1u) };
 	long read_cache{ 32 };
 	long write_cache{ 64 };
+	/** ZSTD compression with dictionary training for the blocks table, enabled by default in builds with NANO_ROCKSDB_ZSTD */
+	bool compress_blocks{ zstd_supported () };
+	/** Prefix Bloom filters on the account part of pending keys */
+	bool pending_prefix_filter{ true };
+	/** Partitioned index and filter blocks, kept in the block cache, for tables serving mostly point lookups */
+	bool partitioned_filters{ true };
+
+	/** Whether this build of RocksDB supports ZSTD compression */
+	static bool constexpr zstd_supported ()
+	{
+#ifdef NANO_ROCKSDB_ZSTD
+		return true;
+#else
+		return false;
+#endif
+	}
 };
 }
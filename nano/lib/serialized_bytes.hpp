@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Holds the serialized form of an object so it can be sent again without serializing it.
+ * Not synchronized, it is set while the object is still owned by a single thread, before it is uniqued or otherwise shared.
+ *
+ * Copies start out empty, a copy is usually made to be modified and the bytes would no longer match.
+ */
+class serialized_bytes final
+{
+public:
+	using bytes_t = std::shared_ptr<std::vector<uint8_t> const>;
+
+	serialized_bytes () = default;
+
+	serialized_bytes (serialized_bytes const &)
+	{
+	}
+
+	serialized_bytes & operator= (serialized_bytes const &)
+	{
+		bytes = nullptr;
+		return *this;
+	}
+
+	bytes_t const & get () const
+	{
+		return bytes;
+	}
+
+	void set (bytes_t const & bytes_a)
+	{
+		bytes = bytes_a;
+	}
+
+private:
+	bytes_t bytes;
+};
+}
@@ -19,6 +19,10 @@ enum class type
 	block,
 	ledger,
 	rollback,
+	block_cache,
+	write_group,
+	write_group_writer,
+	write_group_latency,
 	network,
 	tcp_server,
 	vote,
@@ -145,6 +149,11 @@ enum class detail
 	prioritized,
 	pending,
 
+	// cache
+	hit,
+	miss,
+	evicted,
+
 	// processing queue
 	queue,
 	overfill,
@@ -183,11 +192,15 @@ enum class detail
 	balance_mismatch,
 	representative_mismatch,
 	block_position,
+	cache_snapshot_loaded,
+	cache_snapshot_invalid,
+	cache_snapshot_written,
 
 	// blockprocessor
 	process_blocking,
 	process_blocking_timeout,
 	force,
+	verified,
 
 	// block source
 	live,
@@ -240,6 +253,8 @@ enum class detail
 	// vote processor
 	vote_overflow,
 	vote_ignored,
+	batch_verified,
+	batch_invalid,
 
 	// election specific
 	vote_new,
@@ -552,6 +567,20 @@ enum class detail
 	blocks_by_account,
 	account_info_by_hash,
 
+	// write_group
+	commit,
+	grouped,
+	aborted,
+
+	// store::writer
+	generic,
+	node,
+	blockprocessor,
+	confirmation_height,
+	pruning,
+	voting_final,
+	testing,
+
 	_last // Must be the last enum
 };
 
@@ -573,6 +602,7 @@ enum class sample
 	rep_response_time,
 	vote_generator_final_hashes,
 	vote_generator_hashes,
+	write_group_size,
 
 	_last // Must be the last enum
 };
@@ -105,3 +105,41 @@ void nano::thread_runner::run ()
 		}
 	}
 }
+
+/*
+ * io_context_pool
+ */
+
+nano::io_context_pool::io_context_pool (std::size_t size_a, nano::logger & logger_a, nano::thread_role::name thread_role_a)
+{
+	debug_assert (size_a > 0);
+	for (std::size_t i = 0; i < size_a; ++i)
+	{
+		auto context = std::make_shared<asio::io_context> (1); // Concurrency hint, the context is only ever run by a single thread
+		runners.push_back (std::make_unique<nano::thread_runner> (context, logger_a, 1, thread_role_a));
+		contexts.push_back (std::move (context));
+	}
+}
+
+nano::io_context_pool::~io_context_pool ()
+{
+	join ();
+}
+
+boost::asio::io_context & nano::io_context_pool::next ()
+{
+	return *contexts[next_index++ % contexts.size ()];
+}
+
+std::size_t nano::io_context_pool::size () const
+{
+	return contexts.size ();
+}
+
+void nano::io_context_pool::join ()
+{
+	for (auto & runner : runners)
+	{
+		runner->join ();
+	}
+}
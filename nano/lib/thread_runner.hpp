@@ -8,6 +8,10 @@
 
 #include <boost/thread.hpp>
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace nano
 {
 namespace asio = boost::asio;
@@ -39,6 +43,29 @@ private:
 	void run ();
 };
 
+/**
+ * Set of io_contexts each driven by a single thread
+ * Handlers of objects bound to one of the contexts always run on the same thread, avoiding strand hops between threads and contention on a shared handler queue
+ */
+class io_context_pool final
+{
+public:
+	io_context_pool (std::size_t size, nano::logger &, nano::thread_role::name thread_role = nano::thread_role::name::io);
+	~io_context_pool ();
+
+	/** Context to bind the next object to, contexts are handed out round robin */
+	asio::io_context & next ();
+	std::size_t size () const;
+
+	/** Wait for IO threads to complete */
+	void join ();
+
+private:
+	std::vector<std::shared_ptr<asio::io_context>> contexts;
+	std::vector<std::unique_ptr<nano::thread_runner>> runners;
+	std::atomic<std::size_t> next_index{ 0 };
+};
+
 constexpr unsigned asio_handler_tracking_threshold ()
 {
 #if NANO_ASIO_HANDLER_TRACKING == 0
@@ -16,6 +16,13 @@ public:
 	using value_type = Value;
 
 	std::shared_ptr<Value> unique (std::shared_ptr<Value> const & value)
+	{
+		return unique (value, [] (Value &) {});
+	}
+
+	/** Calls `keep` on `value` only if it is the one kept, before it becomes visible to other callers */
+	template <typename Keep>
+	std::shared_ptr<Value> unique (std::shared_ptr<Value> const & value, Keep const & keep)
 	{
 		if (value == nullptr)
 		{
@@ -39,6 +46,7 @@ public:
 		}
 		else
 		{
+			keep (*value);
 			existing = value;
 		}
 
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace nano
+{
+namespace detail
+{
+	inline std::atomic<uint64_t> versioned_snapshot_instances{ 0 };
+}
+
+/**
+ * Publishes immutable snapshots of a value to many reader threads
+ * Each reader thread keeps the last snapshot it has seen and only locks to pick up a newer one once the published version
+ * changes, so repeated reads touch no shared state besides that version.
+ * Publishing is not synchronized with other writers, owners with several writers have to serialize them.
+ */
+template <typename T>
+class versioned_snapshot final
+{
+public:
+	explicit versioned_snapshot (std::shared_ptr<T> initial) :
+		id{ ++detail::versioned_snapshot_instances },
+		current{ std::move (initial) }
+	{
+	}
+
+	/**
+	 * Snapshot cached by the calling thread, refreshed if a newer one has been published
+	 * The cache is shared by all instances of the same type, the reference is only valid until the thread calls `get` again
+	 */
+	std::shared_ptr<T const> const & get () const
+	{
+		// Shared by all instances so the fast path only compares two integers
+		thread_local cached_entry cached;
+
+		if (cached.id != id || cached.version != version.load (std::memory_order_acquire))
+		{
+			nano::lock_guard<nano::mutex> guard{ mutex };
+			cached.id = id;
+			cached.version = version.load (std::memory_order_relaxed);
+			cached.value = current;
+		}
+		return cached.value;
+	}
+
+	/** Latest published value, only to be used by the writer */
+	T & latest () const
+	{
+		return *current;
+	}
+
+	/** Replaces the value, readers pick it up on their next `get` while those still using the previous one keep it alive */
+	void publish (std::shared_ptr<T> next)
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		current = std::move (next);
+		version.fetch_add (1, std::memory_order_release);
+	}
+
+private:
+	class cached_entry final
+	{
+	public:
+		uint64_t id{ 0 };
+		uint64_t version{ 0 };
+		std::shared_ptr<T const> value;
+	};
+
+	/** Identifies this instance in the entries cached by reader threads */
+	uint64_t const id;
+	/** Protected by `mutex` against concurrent publishing, the writer reads it without locking */
+	std::shared_ptr<T> current;
+	/** Incremented for every publish, readers compare it to the version of their cached entry */
+	std::atomic<uint64_t> version{ 0 };
+	/** Only held to swap or copy `current` */
+	mutable nano::mutex mutex;
+};
+}
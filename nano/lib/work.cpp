@@ -1,4 +1,3 @@
-#include <nano/crypto/blake2/blake2.h>
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/epoch.hpp>
@@ -8,6 +7,7 @@
 #include <nano/lib/work_version.hpp>
 #include <nano/node/xorshift.hpp>
 
+#include <array>
 #include <future>
 
 std::string nano::to_string (nano::work_version const version_a)
@@ -25,12 +25,13 @@ std::string nano::to_string (nano::work_version const version_a)
 	return result;
 }
 
-nano::work_pool::work_pool (nano::network_constants & network_constants, unsigned max_threads_a, std::chrono::nanoseconds pow_rate_limiter_a, nano::opencl_work_func_t opencl_a) :
+nano::work_pool::work_pool (nano::network_constants & network_constants, unsigned max_threads_a, std::chrono::nanoseconds pow_rate_limiter_a, nano::opencl_work_func_t opencl_a, nano::work_engine_type engine_a) :
 	network_constants{ network_constants },
 	ticket (0),
 	done (false),
 	pow_rate_limiter (pow_rate_limiter_a),
-	opencl (opencl_a)
+	opencl (opencl_a),
+	engine{ engine_a }
 {
 	static_assert (ATOMIC_INT_LOCK_FREE == 2, "Atomic int needed");
 
@@ -66,8 +67,10 @@ void nano::work_pool::loop (uint64_t thread)
 	nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (rng.s.data ()), rng.s.size () * sizeof (decltype (rng.s)::value_type));
 	uint64_t work;
 	uint64_t output;
-	blake2b_state hash;
-	blake2b_init (&hash, sizeof (output));
+	// Candidate nonces and their work values, one per engine lane
+	std::array<uint64_t, nano::work_engine::max_lanes> nonces;
+	std::array<uint64_t, nano::work_engine::max_lanes> values;
+	auto const lanes = engine.lanes ();
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	auto pow_sleep = pow_rate_limiter;
 	while (!done)
@@ -102,14 +105,20 @@ void nano::work_pool::loop (uint64_t thread)
 					// Don't query main memory every iteration in order to reduce memory bus traffic
 					// All operations here operate on stack memory
 					// Count iterations down to zero since comparing to zero is easier than comparing to another number
-					unsigned iteration (256);
+					// Each iteration hashes one nonce per engine lane, keep the number of attempts between ticket checks constant
+					unsigned iteration (256 / lanes);
 					while (iteration && output < current_l.difficulty)
 					{
-						work = rng.next ();
-						blake2b_update (&hash, reinterpret_cast<uint8_t *> (&work), sizeof (work));
-						blake2b_update (&hash, current_l.item.bytes.data (), current_l.item.bytes.size ());
-						blake2b_final (&hash, reinterpret_cast<uint8_t *> (&output), sizeof (output));
-						blake2b_init (&hash, sizeof (output));
+						for (auto i (0u); i < lanes; ++i)
+						{
+							nonces[i] = rng.next ();
+						}
+						engine.values (current_l.item, nonces.data (), values.data ());
+						for (auto i (0u); i < lanes && output < current_l.difficulty; ++i)
+						{
+							work = nonces[i];
+							output = values[i];
+						}
 						iteration -= 1;
 					}
 
@@ -5,6 +5,7 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/observer_set.hpp>
 #include <nano/lib/utility.hpp>
+#include <nano/lib/work_engine.hpp>
 #include <nano/node/openclwork.hpp>
 
 #include <boost/optional.hpp>
@@ -40,7 +41,7 @@ public:
 class work_pool final
 {
 public:
-	work_pool (nano::network_constants & network_constants, unsigned, std::chrono::nanoseconds = std::chrono::nanoseconds (0), nano::opencl_work_func_t = nullptr);
+	work_pool (nano::network_constants & network_constants, unsigned, std::chrono::nanoseconds = std::chrono::nanoseconds (0), nano::opencl_work_func_t = nullptr, nano::work_engine_type = nano::work_engine::best ());
 	~work_pool ();
 	void loop (uint64_t);
 	void stop ();
@@ -60,6 +61,7 @@ public:
 	nano::condition_variable producer_condition;
 	std::chrono::nanoseconds pow_rate_limiter;
 	nano::opencl_work_func_t opencl;
+	nano::work_engine const engine;
 	nano::observer_set<bool> work_observers;
 
 	nano::container_info container_info () const;
@@ -0,0 +1,224 @@
+#include <nano/lib/utility.hpp>
+#include <nano/lib/work_engine.hpp>
+#include <nano/lib/work_engine_kernels.hpp>
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define NANO_WORK_ENGINE_X86 1
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace
+{
+class scalar_ops
+{
+public:
+	using vec = uint64_t;
+
+	static vec set1 (uint64_t value)
+	{
+		return value;
+	}
+	static vec load (uint64_t const * source)
+	{
+		return *source;
+	}
+	static void store (uint64_t * target, vec value)
+	{
+		*target = value;
+	}
+	static vec add (vec a, vec b)
+	{
+		return a + b;
+	}
+	static vec xor_ (vec a, vec b)
+	{
+		return a ^ b;
+	}
+	static vec rotr32 (vec x)
+	{
+		return (x >> 32) | (x << 32);
+	}
+	static vec rotr24 (vec x)
+	{
+		return (x >> 24) | (x << 40);
+	}
+	static vec rotr16 (vec x)
+	{
+		return (x >> 16) | (x << 48);
+	}
+	static vec rotr63 (vec x)
+	{
+		return (x >> 63) | (x << 1);
+	}
+};
+
+#if NANO_WORK_ENGINE_X86
+#if defined(_MSC_VER)
+bool os_saves (unsigned long long mask)
+{
+	int info[4];
+	__cpuid (info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	return osxsave && (_xgetbv (0) & mask) == mask;
+}
+
+bool cpu_supports (nano::work_engine_type type_a)
+{
+	int info[4];
+	__cpuid (info, 0);
+	auto max_leaf = info[0];
+	__cpuid (info, 1);
+	bool sse41 = (info[2] & (1 << 19)) != 0;
+	int extended[4] = {};
+	if (max_leaf >= 7)
+	{
+		__cpuidex (extended, 7, 0);
+	}
+	switch (type_a)
+	{
+		case nano::work_engine_type::sse41:
+			return sse41;
+		case nano::work_engine_type::avx2:
+			// XMM and YMM state
+			return (extended[1] & (1 << 5)) != 0 && os_saves (0x6);
+		case nano::work_engine_type::avx512:
+			// XMM, YMM, opmask and ZMM state
+			return (extended[1] & (1 << 16)) != 0 && os_saves (0xe6);
+		default:
+			return true;
+	}
+}
+#else
+bool cpu_supports (nano::work_engine_type type_a)
+{
+	// Also checks that the operating system saves the extended register state
+	switch (type_a)
+	{
+		case nano::work_engine_type::sse41:
+			return __builtin_cpu_supports ("sse4.1");
+		case nano::work_engine_type::avx2:
+			return __builtin_cpu_supports ("avx2");
+		case nano::work_engine_type::avx512:
+			return __builtin_cpu_supports ("avx512f");
+		default:
+			return true;
+	}
+}
+#endif
+#endif
+}
+
+void nano::work_kernels::scalar (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	detail::compress<scalar_ops> (root, nonces, values);
+}
+
+std::string_view nano::to_string (nano::work_engine_type type_a)
+{
+	switch (type_a)
+	{
+		case nano::work_engine_type::scalar:
+			return "scalar";
+		case nano::work_engine_type::sse41:
+			return "sse41";
+		case nano::work_engine_type::avx2:
+			return "avx2";
+		case nano::work_engine_type::avx512:
+			return "avx512";
+	}
+	return "invalid";
+}
+
+nano::work_engine::work_engine (nano::work_engine_type type_a) :
+	type_m{ supported (type_a) ? type_a : nano::work_engine_type::scalar }
+{
+	switch (type_m)
+	{
+#if NANO_WORK_ENGINE_X86
+		case nano::work_engine_type::sse41:
+			lanes_m = 2;
+			kernel = nano::work_kernels::sse41;
+			break;
+		case nano::work_engine_type::avx2:
+			lanes_m = 4;
+			kernel = nano::work_kernels::avx2;
+			break;
+		case nano::work_engine_type::avx512:
+			lanes_m = 8;
+			kernel = nano::work_kernels::avx512;
+			break;
+#endif
+		default:
+			lanes_m = 1;
+			kernel = nano::work_kernels::scalar;
+			break;
+	}
+	debug_assert (lanes_m <= max_lanes);
+}
+
+nano::work_engine_type nano::work_engine::type () const
+{
+	return type_m;
+}
+
+std::size_t nano::work_engine::lanes () const
+{
+	return lanes_m;
+}
+
+void nano::work_engine::values (nano::root const & root_a, uint64_t const * nonces_a, uint64_t * values_a) const
+{
+	// Message words are little endian, same as the byte order work values are read in
+	uint64_t root[4];
+	std::memcpy (root, root_a.bytes.data (), sizeof (root));
+	kernel (root, nonces_a, values_a);
+}
+
+bool nano::work_engine::supported (nano::work_engine_type type_a)
+{
+	if (type_a == nano::work_engine_type::scalar)
+	{
+		return true;
+	}
+#if NANO_WORK_ENGINE_X86
+	static bool const sse41 = cpu_supports (nano::work_engine_type::sse41);
+	static bool const avx2 = cpu_supports (nano::work_engine_type::avx2);
+	static bool const avx512 = cpu_supports (nano::work_engine_type::avx512);
+	switch (type_a)
+	{
+		case nano::work_engine_type::sse41:
+			return sse41;
+		case nano::work_engine_type::avx2:
+			return avx2;
+		case nano::work_engine_type::avx512:
+			return avx512;
+		default:
+			break;
+	}
+#endif
+	return false;
+}
+
+nano::work_engine_type nano::work_engine::best ()
+{
+	auto engines = available ();
+	return engines.back ();
+}
+
+std::vector<nano::work_engine_type> nano::work_engine::available ()
+{
+	std::vector<nano::work_engine_type> result;
+	for (auto type : { nano::work_engine_type::scalar, nano::work_engine_type::sse41, nano::work_engine_type::avx2, nano::work_engine_type::avx512 })
+	{
+		if (supported (type))
+		{
+			result.push_back (type);
+		}
+	}
+	return result;
+}
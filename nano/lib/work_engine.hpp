@@ -0,0 +1,53 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace nano
+{
+enum class work_engine_type
+{
+	scalar,
+	sse41,
+	avx2,
+	avx512,
+};
+
+std::string_view to_string (nano::work_engine_type);
+
+/**
+ * CPU work hashing engine. Computes the work value of several nonces against the same root in one call,
+ * one nonce per SIMD lane, using a blake2b compression specialized for the fixed 40 byte (nonce + root) input.
+ * The instruction set is selected at runtime from what the running CPU supports.
+ */
+class work_engine final
+{
+public:
+	static std::size_t constexpr max_lanes = 8;
+
+	explicit work_engine (nano::work_engine_type = best ());
+
+	nano::work_engine_type type () const;
+	/** Number of nonces hashed by a single call to `values` */
+	std::size_t lanes () const;
+	/** Writes the work value of `lanes ()` nonces into `values_a`, equal to `nano::work_thresholds::value` for each nonce */
+	void values (nano::root const &, uint64_t const * nonces_a, uint64_t * values_a) const;
+
+	static bool supported (nano::work_engine_type);
+	/** Widest engine supported by the running CPU */
+	static nano::work_engine_type best ();
+	/** All engines supported by the running CPU, narrowest first */
+	static std::vector<nano::work_engine_type> available ();
+
+private:
+	using kernel_t = void (*) (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+
+	nano::work_engine_type type_m;
+	std::size_t lanes_m;
+	kernel_t kernel;
+};
+}
@@ -0,0 +1,60 @@
+#include <nano/lib/work_engine_kernels.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+namespace
+{
+/** Four lanes, one per 64 bit quarter of an AVX2 register */
+class avx2_ops
+{
+public:
+	using vec = __m256i;
+
+	static vec set1 (uint64_t value)
+	{
+		return _mm256_set1_epi64x (static_cast<long long> (value));
+	}
+	static vec load (uint64_t const * source)
+	{
+		return _mm256_loadu_si256 (reinterpret_cast<__m256i const *> (source));
+	}
+	static void store (uint64_t * target, vec value)
+	{
+		_mm256_storeu_si256 (reinterpret_cast<__m256i *> (target), value);
+	}
+	static vec add (vec a, vec b)
+	{
+		return _mm256_add_epi64 (a, b);
+	}
+	static vec xor_ (vec a, vec b)
+	{
+		return _mm256_xor_si256 (a, b);
+	}
+	static vec rotr32 (vec x)
+	{
+		return _mm256_shuffle_epi32 (x, _MM_SHUFFLE (2, 3, 0, 1));
+	}
+	// Byte shuffles operate within each 128 bit half, so the pattern is repeated
+	static vec rotr24 (vec x)
+	{
+		return _mm256_shuffle_epi8 (x, _mm256_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10));
+	}
+	static vec rotr16 (vec x)
+	{
+		return _mm256_shuffle_epi8 (x, _mm256_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9));
+	}
+	static vec rotr63 (vec x)
+	{
+		return _mm256_xor_si256 (_mm256_srli_epi64 (x, 63), _mm256_add_epi64 (x, x));
+	}
+};
+}
+
+void nano::work_kernels::avx2 (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	detail::compress<avx2_ops> (root, nonces, values);
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include <nano/lib/work_engine_kernels.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+namespace
+{
+/** Eight lanes, one per 64 bit element of an AVX-512 register, using native 64 bit rotates */
+class avx512_ops
+{
+public:
+	using vec = __m512i;
+
+	static vec set1 (uint64_t value)
+	{
+		return _mm512_set1_epi64 (static_cast<long long> (value));
+	}
+	static vec load (uint64_t const * source)
+	{
+		return _mm512_loadu_si512 (source);
+	}
+	static void store (uint64_t * target, vec value)
+	{
+		_mm512_storeu_si512 (target, value);
+	}
+	static vec add (vec a, vec b)
+	{
+		return _mm512_add_epi64 (a, b);
+	}
+	static vec xor_ (vec a, vec b)
+	{
+		return _mm512_xor_si512 (a, b);
+	}
+	static vec rotr32 (vec x)
+	{
+		return _mm512_ror_epi64 (x, 32);
+	}
+	static vec rotr24 (vec x)
+	{
+		return _mm512_ror_epi64 (x, 24);
+	}
+	static vec rotr16 (vec x)
+	{
+		return _mm512_ror_epi64 (x, 16);
+	}
+	static vec rotr63 (vec x)
+	{
+		return _mm512_ror_epi64 (x, 63);
+	}
+};
+}
+
+void nano::work_kernels::avx512 (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	detail::compress<avx512_ops> (root, nonces, values);
+}
+
+#endif
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+ * Blake2b compression specialized for work generation: a single final block holding an 8 byte nonce followed
+ * by a 32 byte root, producing an 8 byte digest. Instantiated once per instruction set with an `Ops` type
+ * providing the vector primitives, each instantiation in its own translation unit compiled for that instruction set.
+ */
+
+namespace nano::work_kernels
+{
+void scalar (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+void sse41 (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+void avx2 (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+void avx512 (uint64_t const * root, uint64_t const * nonces, uint64_t * values);
+
+namespace detail
+{
+	uint64_t constexpr iv[8] = {
+		0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+		0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+	};
+
+	uint8_t constexpr sigma[12][16] = {
+		{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+		{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+		{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+		{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+		{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+		{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+		{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+		{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+		{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+		{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+		{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+		{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+	};
+
+	// Parameter block word 0: 8 byte digest, no key, fanout 1, depth 1
+	uint64_t constexpr param0 = 0x01010008ULL;
+	// Total input length: 8 byte nonce + 32 byte root
+	uint64_t constexpr input_length = 40;
+
+	/** Computes Ops::lanes work values, one per nonce. `root` holds the 32 byte root as four little endian words */
+	template <typename Ops>
+	inline void compress (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+	{
+		using vec = typename Ops::vec;
+
+		vec const zero = Ops::set1 (0);
+		vec m[16] = {
+			Ops::load (nonces), Ops::set1 (root[0]), Ops::set1 (root[1]), Ops::set1 (root[2]), Ops::set1 (root[3]),
+			zero, zero, zero, zero, zero, zero, zero, zero, zero, zero, zero
+		};
+		vec const h0 = Ops::set1 (iv[0] ^ param0);
+		vec v[16] = {
+			h0, Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+			Ops::set1 (iv[4]), Ops::set1 (iv[5]), Ops::set1 (iv[6]), Ops::set1 (iv[7]),
+			Ops::set1 (iv[0]), Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+			Ops::set1 (iv[4] ^ input_length), Ops::set1 (iv[5]), Ops::set1 (~iv[6]), Ops::set1 (iv[7])
+		};
+
+#define NANO_WORK_G(r, i, a, b, c, d)                                         \
+	a = Ops::add (Ops::add (a, b), m[sigma[r][2 * i]]);                       \
+	d = Ops::rotr32 (Ops::xor_ (d, a));                                       \
+	c = Ops::add (c, d);                                                      \
+	b = Ops::rotr24 (Ops::xor_ (b, c));                                       \
+	a = Ops::add (Ops::add (a, b), m[sigma[r][2 * i + 1]]);                   \
+	d = Ops::rotr16 (Ops::xor_ (d, a));                                       \
+	c = Ops::add (c, d);                                                      \
+	b = Ops::rotr63 (Ops::xor_ (b, c));
+
+#define NANO_WORK_ROUND(r)                           \
+	NANO_WORK_G (r, 0, v[0], v[4], v[8], v[12]);  \
+	NANO_WORK_G (r, 1, v[1], v[5], v[9], v[13]);  \
+	NANO_WORK_G (r, 2, v[2], v[6], v[10], v[14]); \
+	NANO_WORK_G (r, 3, v[3], v[7], v[11], v[15]); \
+	NANO_WORK_G (r, 4, v[0], v[5], v[10], v[15]); \
+	NANO_WORK_G (r, 5, v[1], v[6], v[11], v[12]); \
+	NANO_WORK_G (r, 6, v[2], v[7], v[8], v[13]);  \
+	NANO_WORK_G (r, 7, v[3], v[4], v[9], v[14]);
+
+		NANO_WORK_ROUND (0);
+		NANO_WORK_ROUND (1);
+		NANO_WORK_ROUND (2);
+		NANO_WORK_ROUND (3);
+		NANO_WORK_ROUND (4);
+		NANO_WORK_ROUND (5);
+		NANO_WORK_ROUND (6);
+		NANO_WORK_ROUND (7);
+		NANO_WORK_ROUND (8);
+		NANO_WORK_ROUND (9);
+		NANO_WORK_ROUND (10);
+		NANO_WORK_ROUND (11);
+
+#undef NANO_WORK_ROUND
+#undef NANO_WORK_G
+
+		// Only the first word of the chained state is part of the 8 byte digest
+		Ops::store (values, Ops::xor_ (h0, Ops::xor_ (v[0], v[8])));
+	}
+}
+}
@@ -0,0 +1,59 @@
+#include <nano/lib/work_engine_kernels.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+namespace
+{
+/** Two lanes, one per 64 bit half of an SSE register */
+class sse41_ops
+{
+public:
+	using vec = __m128i;
+
+	static vec set1 (uint64_t value)
+	{
+		return _mm_set1_epi64x (static_cast<long long> (value));
+	}
+	static vec load (uint64_t const * source)
+	{
+		return _mm_loadu_si128 (reinterpret_cast<__m128i const *> (source));
+	}
+	static void store (uint64_t * target, vec value)
+	{
+		_mm_storeu_si128 (reinterpret_cast<__m128i *> (target), value);
+	}
+	static vec add (vec a, vec b)
+	{
+		return _mm_add_epi64 (a, b);
+	}
+	static vec xor_ (vec a, vec b)
+	{
+		return _mm_xor_si128 (a, b);
+	}
+	static vec rotr32 (vec x)
+	{
+		return _mm_shuffle_epi32 (x, _MM_SHUFFLE (2, 3, 0, 1));
+	}
+	static vec rotr24 (vec x)
+	{
+		return _mm_shuffle_epi8 (x, _mm_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10));
+	}
+	static vec rotr16 (vec x)
+	{
+		return _mm_shuffle_epi8 (x, _mm_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9));
+	}
+	static vec rotr63 (vec x)
+	{
+		return _mm_xor_si128 (_mm_srli_epi64 (x, 63), _mm_add_epi64 (x, x));
+	}
+};
+}
+
+void nano::work_kernels::sse41 (uint64_t const * root, uint64_t const * nonces, uint64_t * values)
+{
+	detail::compress<sse41_ops> (root, nonces, values);
+}
+
+#endif
@@ -2,8 +2,10 @@
 #include <nano/lib/block_type.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/cli.hpp>
+#include <nano/lib/enum_util.hpp>
 #include <nano/lib/thread_runner.hpp>
 #include <nano/lib/utility.hpp>
+#include <nano/lib/work_engine.hpp>
 #include <nano/lib/work_version.hpp>
 #include <nano/nano_node/daemon.hpp>
 #include <nano/node/active_elections.hpp>
@@ -14,7 +16,10 @@
 #include <nano/node/ipc/ipc_server.hpp>
 #include <nano/node/json_handler.hpp>
 #include <nano/node/node.hpp>
+#include <nano/node/transport/fake.hpp>
 #include <nano/node/transport/inproc.hpp>
+#include <nano/node/transport/message_deserializer.hpp>
+#include <nano/node/transport/traffic_capture.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/vote.hpp>
@@ -131,6 +136,7 @@ int main (int argc, char * const * argv)
 		("debug_profile_process", "Profile active blocks processing (only for nano_dev_network)")
 		("debug_profile_votes", "Profile votes processing (only for nano_dev_network)")
 		("debug_profile_frontiers_confirmation", "Profile frontiers confirmation speed (only for nano_dev_network)")
+		("debug_replay_traffic", "Replay inbound traffic captured with --capture_traffic from --file against a copy of the ledger in --data_path and profile its processing")
 		("debug_random_feed", "Generates output to RNG test suites")
 		("debug_rpc", "Read an RPC command from stdin and invoke it. Network operations will have no effect.")
 		("debug_peers", "Display peer IPv6:port connections")
@@ -147,6 +153,8 @@ int main (int argc, char * const * argv)
 		("multiplier", boost::program_options::value<std::string> (), "Defines <multiplier> for work generation. Overrides <difficulty>")
 		("count", boost::program_options::value<std::string> (), "Defines <count> for various commands")
 		("pow_sleep_interval", boost::program_options::value<std::string> (), "Defines the amount to sleep inbetween each pow calculation attempt")
+		("work_engine", boost::program_options::value<std::string> (), "Defines the CPU work engine for debug_profile_generate: scalar, sse41, avx2 or avx512. Use \"compare\" to measure the hash rate of every engine supported by this CPU")
+		("replay_speed", boost::program_options::value<std::string> (), "Defines the speed for debug_replay_traffic: \"recorded\" to keep the captured message timing or \"max\" to replay as fast as possible (default)")
 		("address_column", boost::program_options::value<std::string> (), "Defines which column the addresses are located, 0 indexed (check --debug_output_last_backtrace_dump output)")
 		("silent", "Silent command execution")
 		("pid_file", boost::program_options::value<std::string> (), "If present, node will write its process id to the specified file and delete the file upon exit");
@@ -548,11 +556,59 @@ int main (int argc, char * const * argv)
 				pow_rate_limiter = std::chrono::nanoseconds (boost::lexical_cast<uint64_t> (pow_sleep_interval_it->second.as<std::string> ()));
 			}
 
-			nano::work_pool work{ network_params.network, std::numeric_limits<unsigned>::max (), pow_rate_limiter };
+			auto engine = nano::work_engine::best ();
+			auto engine_it = vm.find ("work_engine");
+			if (engine_it != vm.end ())
+			{
+				auto engine_name (engine_it->second.as<std::string> ());
+				if (engine_name == "compare")
+				{
+					// Single threaded hash rate of each engine, relative to the scalar implementation
+					nano::root root{ 1 };
+					uint64_t constexpr count{ 1U << 24 };
+					double scalar_rate{ 0 };
+					uint64_t sink{ 0 };
+					for (auto type : nano::work_engine::available ())
+					{
+						nano::work_engine engine_l{ type };
+						std::array<uint64_t, nano::work_engine::max_lanes> nonces{};
+						std::array<uint64_t, nano::work_engine::max_lanes> values{};
+						auto begin (std::chrono::steady_clock::now ());
+						for (uint64_t i (0); i < count; i += engine_l.lanes ())
+						{
+							for (auto lane (0u); lane < engine_l.lanes (); ++lane)
+							{
+								nonces[lane] = i + lane;
+							}
+							engine_l.values (root, nonces.data (), values.data ());
+							sink ^= values[0];
+						}
+						auto seconds (std::chrono::duration<double> (std::chrono::steady_clock::now () - begin).count ());
+						auto rate (count / seconds);
+						if (type == nano::work_engine_type::scalar)
+						{
+							scalar_rate = rate;
+						}
+						std::cout << boost::str (boost::format ("%|1$-8| %|2$ 5d| lanes %|3$ 12.0f| hashes/s %|4$ 6.2f|x\n") % nano::to_string (type) % engine_l.lanes () % rate % (rate / scalar_rate));
+					}
+					std::ostringstream oss (std::to_string (sink)); // IO forces compiler to not dismiss the variable
+					return 0;
+				}
+				auto available (nano::work_engine::available ());
+				auto found = std::find_if (available.begin (), available.end (), [&engine_name] (auto type) { return nano::to_string (type) == engine_name; });
+				if (found == available.end ())
+				{
+					std::cerr << "Invalid or unsupported work engine\n";
+					return -1;
+				}
+				engine = *found;
+			}
+
+			nano::work_pool work{ network_params.network, std::numeric_limits<unsigned>::max (), pow_rate_limiter, nullptr, engine };
 			nano::change_block block (0, 0, nano::keypair ().prv, 0, 0);
 			if (!result)
 			{
-				std::cerr << boost::str (boost::format ("Starting generation profiling. Difficulty: %1$#x (%2%x from base difficulty %3$#x)\n") % difficulty % nano::to_string (nano::difficulty::to_multiplier (difficulty, nano::work_thresholds::publish_full.base), 4) % nano::work_thresholds::publish_full.base);
+				std::cerr << boost::str (boost::format ("Starting generation profiling. Engine: %4%, difficulty: %1$#x (%2%x from base difficulty %3$#x)\n") % difficulty % nano::to_string (nano::difficulty::to_multiplier (difficulty, nano::work_thresholds::publish_full.base), 4) % nano::work_thresholds::publish_full.base % nano::to_string (work.engine.type ()));
 				while (!result)
 				{
 					block.hashables.previous.qwords[0] += 1;
@@ -1896,6 +1952,164 @@ int main (int argc, char * const * argv)
 			std::cout << boost::str (boost::format ("%|1$ 12d| seconds \n%2% blocks per second") % seconds % (block_count * us_in_second / time)) << std::endl;
 			release_assert (node.node->ledger.block_count () == block_count);
 		}
+		else if (vm.count ("debug_replay_traffic"))
+		{
+			if (vm.count ("file") != 1)
+			{
+				std::cerr << "Capture file must be specified with --file" << std::endl;
+				return 1;
+			}
+			nano::transport::traffic_reader reader{ vm["file"].as<std::string> () };
+			if (reader.init_error ())
+			{
+				std::cerr << "Unable to read capture file" << std::endl;
+				return 1;
+			}
+			if (reader.network () != network_params.network.current_network)
+			{
+				std::cerr << "Capture file was recorded on a different network" << std::endl;
+				return 1;
+			}
+			bool recorded_speed = false;
+			if (auto replay_speed_it = vm.find ("replay_speed"); replay_speed_it != vm.end ())
+			{
+				auto const speed = replay_speed_it->second.as<std::string> ();
+				if (speed != "recorded" && speed != "max")
+				{
+					std::cerr << "Invalid replay_speed, expected \"recorded\" or \"max\"" << std::endl;
+					return 1;
+				}
+				recorded_speed = speed == "recorded";
+			}
+
+			// Replay against a copy so the original ledger is left untouched
+			auto const replay_path = nano::unique_path ();
+			std::cout << boost::str (boost::format ("Copying ledger to %1%...") % replay_path) << std::endl;
+			std::filesystem::copy (data_path, replay_path, std::filesystem::copy_options::recursive);
+
+			nano::node_flags node_flags;
+			nano::update_flags (node_flags, vm);
+			// Only the replayed messages may reach the node
+			node_flags.disable_tcp_realtime = true;
+			node_flags.disable_bootstrap_listener = true;
+			node_flags.disable_add_initial_peers = true;
+			node_flags.disable_rep_crawler = true;
+			node_flags.disable_ongoing_bootstrap = true;
+			node_flags.disable_search_pending = true;
+			node_flags.disable_backup = true;
+			node_flags.capture_traffic.clear ();
+			nano::node_wrapper node_wrapper (replay_path, data_path, node_flags);
+			auto node = node_wrapper.node;
+			node->start ();
+
+			// Each captured connection is replayed through its own channel, so fair queuing behaves as it did live
+			std::unordered_map<uint64_t, std::shared_ptr<nano::transport::fake::channel>> channels;
+			auto channel_for = [&node, &channels] (uint64_t channel_id) {
+				auto & channel = channels[channel_id];
+				if (!channel)
+				{
+					channel = std::make_shared<nano::transport::fake::channel> (*node);
+					auto const address = boost::asio::ip::make_address_v6 (boost::str (boost::format ("::ffff:10.%1%.%2%.%3%") % ((channel_id >> 16) & 0xff) % ((channel_id >> 8) & 0xff) % (channel_id & 0xff)));
+					channel->set_endpoint (nano::endpoint{ address, 7075 });
+				}
+				return channel;
+			};
+
+			std::vector<uint8_t> const * current = nullptr;
+			std::size_t offset = 0;
+			auto deserializer = std::make_shared<nano::transport::message_deserializer> (node->network_params.network, node->network.filter, node->block_uniquer, node->vote_uniquer,
+			[&current, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+				debug_assert (current != nullptr);
+				auto const available = std::min (size_a, current->size () - offset);
+				std::copy_n (current->begin () + offset, available, data_a->begin ());
+				offset += available;
+				callback_a (available == size_a ? boost::system::error_code{} : boost::asio::error::eof, available);
+			});
+
+			std::cout << "Replaying traffic..." << std::endl;
+			uint64_t message_count = 0;
+			uint64_t replayed_count = 0;
+			uint64_t invalid_count = 0;
+			auto const begin = std::chrono::steady_clock::now ();
+			while (auto record = reader.next ())
+			{
+				++message_count;
+				if (recorded_speed)
+				{
+					std::this_thread::sleep_until (begin + record->timestamp);
+				}
+				current = &record->data;
+				offset = 0;
+				std::unique_ptr<nano::message> message;
+				deserializer->status = nano::transport::parse_status::none;
+				deserializer->read ([&message] (boost::system::error_code ec, std::unique_ptr<nano::message> message_a) {
+					message = std::move (message_a);
+				});
+				if (!message)
+				{
+					// Duplicates are filtered the same way they are during live operation
+					++invalid_count;
+					continue;
+				}
+				switch (message->type ())
+				{
+					case nano::message_type::publish:
+					case nano::message_type::confirm_req:
+					case nano::message_type::confirm_ack:
+					{
+						while (!recorded_speed && node->message_processor.size () >= node->config.message_processor.max_queue)
+						{
+							std::this_thread::sleep_for (std::chrono::microseconds (100));
+						}
+						node->message_processor.put (std::move (message), channel_for (record->channel_id));
+						++replayed_count;
+						break;
+					}
+					default:
+						// Handshakes, keepalives, telemetry and bootstrap traffic depend on live connections
+						break;
+				}
+			}
+			auto const fed = std::chrono::steady_clock::now ();
+
+			// Per stage time needed to drain the queues after the last message was fed
+			auto drain = [] (auto const & size) {
+				auto const start = std::chrono::steady_clock::now ();
+				while (size () > 0)
+				{
+					std::this_thread::sleep_for (std::chrono::milliseconds (1));
+				}
+				return std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start);
+			};
+			auto const message_processor_drain = drain ([&] () { return node->message_processor.size (); });
+			auto const vote_processor_drain = drain ([&] () { return node->vote_processor.size (); });
+			auto const block_processor_drain = drain ([&] () { return node->block_processor.size (); });
+			auto const confirming_set_drain = drain ([&] () { return node->confirming_set.size (); });
+			auto const end = std::chrono::steady_clock::now ();
+
+			auto const seconds = std::max (std::chrono::duration_cast<std::chrono::duration<double>> (end - begin).count (), 1e-6);
+			auto const blocks = node->stats.count (nano::stat::type::blockprocessor_result, nano::stat::detail::progress);
+			auto const votes = node->stats.count (nano::stat::type::vote_processor, nano::stat::detail::batch_verified);
+			auto average_latency = [&node] (nano::store::writer writer) -> uint64_t {
+				auto const detail = nano::enum_util::cast<nano::stat::detail> (writer);
+				auto const count = node->stats.count (nano::stat::type::write_group_writer, detail);
+				return count > 0 ? node->stats.count (nano::stat::type::write_group_latency, detail) / count : 0;
+			};
+
+			std::cout << boost::str (boost::format ("%1% messages read, %2% replayed, %3% filtered or invalid, %4% dropped by message processor\n")
+			% message_count % replayed_count % invalid_count % node->stats.count (nano::stat::type::message_processor, nano::stat::detail::overfill));
+			std::cout << boost::str (boost::format ("Feeding took %1% ms, processing took %2% ms in total\n")
+			% std::chrono::duration_cast<std::chrono::milliseconds> (fed - begin).count () % std::chrono::duration_cast<std::chrono::milliseconds> (end - begin).count ());
+			std::cout << boost::str (boost::format ("%1% blocks processed (%2$.1f blocks/s), %3% votes processed (%4$.1f votes/s), %5% blocks cemented\n")
+			% blocks % (blocks / seconds) % votes % (votes / seconds) % node->stats.count (nano::stat::type::confirming_set, nano::stat::detail::cemented));
+			std::cout << boost::str (boost::format ("Queue drain time: message processor %1% ms, vote processor %2% ms, block processor %3% ms, confirming set %4% ms\n")
+			% message_processor_drain.count () % vote_processor_drain.count () % block_processor_drain.count () % confirming_set_drain.count ());
+			std::cout << boost::str (boost::format ("Average ledger write latency: block processor %1% us, cementing %2% us\n")
+			% average_latency (nano::store::writer::blockprocessor) % average_latency (nano::store::writer::confirmation_height));
+
+			node->stop ();
+			nano::remove_temporary_directories ();
+		}
 		else if (vm.count ("debug_peers"))
 		{
 			auto inactive_node = nano::default_inactive_node (data_path, vm);
@@ -28,19 +28,16 @@ nano::active_elections::active_elections (nano::node & node_a, nano::confirming_
 	recently_confirmed{ config.confirmation_cache },
 	recently_cemented{ config.confirmation_history_size }
 {
-	count_by_behavior.fill (0); // Zero initialize array
-
 	// Cementing blocks might implicitly confirm dependent elections
 	confirming_set.batch_cemented.add ([this] (auto const & cemented) {
 		std::deque<block_cemented_result> results;
+		for (auto const & [block, confirmation_root, source_election] : cemented)
 		{
-			// Process all cemented blocks while holding the lock to avoid races where an election for a block that is already cemented is inserted
-			nano::lock_guard<nano::mutex> guard{ mutex };
-			for (auto const & [block, confirmation_root, source_election] : cemented)
-			{
-				auto result = block_cemented (block, confirmation_root, source_election);
-				results.push_back (result);
-			}
+			// Process cemented blocks while holding the shard lock to avoid races where an election for a block that is already cemented is inserted
+			auto & shard = shard_for (block->qualified_root ());
+			nano::lock_guard<nano::mutex> guard{ shard.mutex };
+			auto result = block_cemented (block, confirmation_root, source_election);
+			results.push_back (result);
 		}
 		{
 			// TODO: This could be offloaded to a separate notification worker, profiling is needed
@@ -99,11 +96,12 @@ void nano::active_elections::stop ()
 
 auto nano::active_elections::block_cemented (std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root, std::shared_ptr<nano::election> const & source_election) -> block_cemented_result
 {
-	debug_assert (!mutex.try_lock ());
+	auto const & shard = shard_for (block->qualified_root ());
+	debug_assert (!shard.mutex.try_lock ());
 	debug_assert (node.block_confirmed (block->hash ()));
 
 	// Dependent elections are implicitly confirmed when their block is cemented
-	auto dependend_election = election_impl (block->qualified_root ());
+	auto dependend_election = election_impl (shard, block->qualified_root ());
 	if (dependend_election)
 	{
 		node.stats.inc (nano::stat::type::active_elections, nano::stat::detail::confirm_dependent);
@@ -210,13 +208,12 @@ int64_t nano::active_elections::limit (nano::election_behavior behavior) const
 int64_t nano::active_elections::vacancy (nano::election_behavior behavior) const
 {
 	auto election_vacancy = [this] (nano::election_behavior behavior) -> int64_t {
-		nano::lock_guard<nano::mutex> guard{ mutex };
 		switch (behavior)
 		{
 			case nano::election_behavior::manual:
 				return std::numeric_limits<int64_t>::max ();
 			case nano::election_behavior::priority:
-				return limit (nano::election_behavior::priority) - static_cast<int64_t> (roots.size ());
+				return limit (nano::election_behavior::priority) - count_total.load ();
 			case nano::election_behavior::hinted:
 			case nano::election_behavior::optimistic:
 				return limit (behavior) - count_by_behavior[behavior];
@@ -232,14 +229,9 @@ int64_t nano::active_elections::vacancy (nano::election_behavior behavior) const
 	return std::min (election_vacancy (behavior), election_winners_vacancy ());
 }
 
-void nano::active_elections::request_confirm (nano::unique_lock<nano::mutex> & lock_a)
+void nano::active_elections::request_confirm ()
 {
-	debug_assert (lock_a.owns_lock ());
-
-	std::size_t const this_loop_target_l (roots.size ());
-	auto const elections_l{ list_active_impl (this_loop_target_l) };
-
-	lock_a.unlock ();
+	auto const elections_l{ list_active () };
 
 	nano::confirmation_solicitor solicitor (node.network, node.config);
 	solicitor.prepare (node.rep_crawler.principal_representatives (std::numeric_limits<std::size_t>::max ()));
@@ -266,27 +258,27 @@ void nano::active_elections::request_confirm (nano::unique_lock<nano::mutex> & l
 	}
 
 	solicitor.flush ();
-	lock_a.lock ();
 }
 
-void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election> election)
+void nano::active_elections::cleanup_election (shard & shard, nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election> election)
 {
-	debug_assert (!mutex.try_lock ());
+	debug_assert (!shard.mutex.try_lock ());
 	debug_assert (lock_a.owns_lock ());
 	debug_assert (!election->confirmed () || recently_confirmed.exists (election->qualified_root));
 
 	// Keep track of election count by election type
 	debug_assert (count_by_behavior[election->behavior ()] > 0);
 	count_by_behavior[election->behavior ()]--;
+	count_total--;
 
 	auto blocks_l = election->blocks ();
 	node.vote_router.disconnect (*election);
 
 	// Erase root info
-	auto it = roots.get<tag_root> ().find (election->qualified_root);
-	release_assert (it != roots.get<tag_root> ().end ());
+	auto it = shard.roots.get<tag_root> ().find (election->qualified_root);
+	release_assert (it != shard.roots.get<tag_root> ().end ());
 	entry entry = *it;
-	roots.get<tag_root> ().erase (it);
+	shard.roots.get<tag_root> ().erase (it);
 
 	node.stats.inc (nano::stat::type::active_elections, nano::stat::detail::stopped);
 	node.stats.inc (nano::stat::type::active_elections, election->confirmed () ? nano::stat::detail::confirmed : nano::stat::detail::unconfirmed);
@@ -331,22 +323,29 @@ void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> &
 
 std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_active (std::size_t max_a)
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-	return list_active_impl (max_a);
-}
-
-std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_active_impl (std::size_t max_a) const
-{
-	std::vector<std::shared_ptr<nano::election>> result_l;
-	result_l.reserve (std::min (max_a, roots.size ()));
+	// Each shard is locked only while its elections are copied, the result is a snapshot merged in insertion order
+	std::vector<std::pair<uint64_t, std::shared_ptr<nano::election>>> entries;
+	entries.reserve (static_cast<std::size_t> (std::max<int64_t> (count_total.load (), 0)));
+	for (auto const & shard : shards)
 	{
-		auto & sorted_roots_l (roots.get<tag_sequenced> ());
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		auto & sorted_roots_l (shard.roots.get<tag_sequenced> ());
 		std::size_t count_l{ 0 };
 		for (auto i = sorted_roots_l.begin (), n = sorted_roots_l.end (); i != n && count_l < max_a; ++i, ++count_l)
 		{
-			result_l.push_back (i->election);
+			entries.emplace_back (i->sequence, i->election);
 		}
 	}
+	auto const count = std::min (max_a, entries.size ());
+	std::partial_sort (entries.begin (), entries.begin () + count, entries.end (), [] (auto const & lhs, auto const & rhs) {
+		return lhs.first < rhs.first;
+	});
+	std::vector<std::shared_ptr<nano::election>> result_l;
+	result_l.reserve (count);
+	for (auto i = entries.begin (), n = entries.begin () + count; i != n; ++i)
+	{
+		result_l.push_back (std::move (i->second));
+	}
 	return result_l;
 }
 
@@ -359,8 +358,9 @@ void nano::active_elections::request_loop ()
 
 		node.stats.inc (nano::stat::type::active, nano::stat::detail::loop);
 
-		request_confirm (lock);
-		debug_assert (lock.owns_lock ());
+		lock.unlock ();
+		request_confirm ();
+		lock.lock ();
 
 		if (!stopped)
 		{
@@ -376,19 +376,22 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 	debug_assert (block_a);
 	debug_assert (block_a->has_sideband ());
 
-	nano::unique_lock<nano::mutex> lock{ mutex };
+	auto const root = block_a->qualified_root ();
+	auto const hash = block_a->hash ();
+	auto & shard = shard_for (root);
+
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
 
 	nano::election_insertion_result result;
 
+	// Checked under the shard lock so that no election is inserted into a shard already emptied by stop ()
 	if (stopped)
 	{
 		return result;
 	}
 
-	auto const root = block_a->qualified_root ();
-	auto const hash = block_a->hash ();
-	auto const existing = roots.get<tag_root> ().find (root);
-	if (existing == roots.get<tag_root> ().end ())
+	auto const existing = shard.roots.get<tag_root> ().find (root);
+	if (existing == shard.roots.get<tag_root> ().end ())
 	{
 		if (!recently_confirmed.exists (root))
 		{
@@ -398,12 +401,13 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 				node.online_reps.observe (rep_a);
 			};
 			result.election = nano::make_shared<nano::election> (node, block_a, nullptr, observe_rep_cb, election_behavior_a);
-			roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a) });
+			shard.roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a), next_sequence++ });
 			node.vote_router.connect (hash, result.election);
 
 			// Keep track of election count by election type
 			debug_assert (count_by_behavior[result.election->behavior ()] >= 0);
 			count_by_behavior[result.election->behavior ()]++;
+			count_total++;
 
 			node.stats.inc (nano::stat::type::active_elections, nano::stat::detail::started);
 			node.stats.inc (nano::stat::type::active_elections_started, to_stat_detail (election_behavior_a));
@@ -446,30 +450,41 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 	return result;
 }
 
+auto nano::active_elections::shard_for (nano::qualified_root const & root_a) -> shard &
+{
+	return shards[std::hash<nano::qualified_root>{}(root_a) % shards.size ()];
+}
+
+auto nano::active_elections::shard_for (nano::qualified_root const & root_a) const -> shard const &
+{
+	return shards[std::hash<nano::qualified_root>{}(root_a) % shards.size ()];
+}
+
 bool nano::active_elections::active (nano::qualified_root const & root_a) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.get<tag_root> ().find (root_a) != roots.get<tag_root> ().end ();
+	auto const & shard = shard_for (root_a);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	return shard.roots.get<tag_root> ().find (root_a) != shard.roots.get<tag_root> ().end ();
 }
 
 bool nano::active_elections::active (nano::block const & block_a) const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-	return roots.get<tag_root> ().find (block_a.qualified_root ()) != roots.get<tag_root> ().end ();
+	return active (block_a.qualified_root ());
 }
 
 std::shared_ptr<nano::election> nano::active_elections::election (nano::qualified_root const & root) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return election_impl (root);
+	auto const & shard = shard_for (root);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	return election_impl (shard, root);
 }
 
-std::shared_ptr<nano::election> nano::active_elections::election_impl (nano::qualified_root const & root) const
+std::shared_ptr<nano::election> nano::active_elections::election_impl (shard const & shard, nano::qualified_root const & root) const
 {
-	debug_assert (!mutex.try_lock ());
+	debug_assert (!shard.mutex.try_lock ());
 	std::shared_ptr<nano::election> result;
-	auto existing = roots.get<tag_root> ().find (root);
-	if (existing != roots.get<tag_root> ().end ())
+	auto existing = shard.roots.get<tag_root> ().find (root);
+	if (existing != shard.roots.get<tag_root> ().end ())
 	{
 		result = existing->election;
 	}
@@ -483,12 +498,13 @@ bool nano::active_elections::erase (nano::block const & block_a)
 
 bool nano::active_elections::erase (nano::qualified_root const & root_a)
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	auto root_it (roots.get<tag_root> ().find (root_a));
-	if (root_it != roots.get<tag_root> ().end ())
+	auto & shard = shard_for (root_a);
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
+	auto root_it (shard.roots.get<tag_root> ().find (root_a));
+	if (root_it != shard.roots.get<tag_root> ().end ())
 	{
 		release_assert (root_it->election->qualified_root == root_a);
-		cleanup_election (lock, root_it->election);
+		cleanup_election (shard, lock, root_it->election);
 		return true;
 	}
 	return false;
@@ -496,30 +512,30 @@ bool nano::active_elections::erase (nano::qualified_root const & root_a)
 
 bool nano::active_elections::empty () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.empty ();
+	return size () == 0;
 }
 
 std::size_t nano::active_elections::size () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.size ();
+	auto count = count_total.load ();
+	debug_assert (count >= 0);
+	return static_cast<std::size_t> (std::max<int64_t> (count, 0));
 }
 
 std::size_t nano::active_elections::size (nano::election_behavior behavior) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto count = count_by_behavior[behavior];
+	auto count = count_by_behavior[behavior].load ();
 	debug_assert (count >= 0);
-	return static_cast<std::size_t> (count);
+	return static_cast<std::size_t> (std::max<int64_t> (count, 0));
 }
 
 bool nano::active_elections::publish (std::shared_ptr<nano::block> const & block_a)
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	auto existing (roots.get<tag_root> ().find (block_a->qualified_root ()));
+	auto & shard = shard_for (block_a->qualified_root ());
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
+	auto existing (shard.roots.get<tag_root> ().find (block_a->qualified_root ()));
 	auto result (true);
-	if (existing != roots.get<tag_root> ().end ())
+	if (existing != shard.roots.get<tag_root> ().end ())
 	{
 		auto election (existing->election);
 		lock.unlock ();
@@ -542,19 +558,23 @@ bool nano::active_elections::publish (std::shared_ptr<nano::block> const & block
 void nano::active_elections::clear ()
 {
 	// TODO: Call erased_callback for each election
+	for (auto & shard : shards)
 	{
-		nano::lock_guard<nano::mutex> guard{ mutex };
-		roots.clear ();
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		for (auto const & entry : shard.roots)
+		{
+			count_by_behavior[entry.election->behavior ()]--;
+			count_total--;
+		}
+		shard.roots.clear ();
 	}
 	vacancy_updated.notify ();
 }
 
 nano::container_info nano::active_elections::container_info () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-
 	nano::container_info info;
-	info.put ("roots", roots.size ());
+	info.put ("roots", size ());
 	info.put ("normal", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::priority]));
 	info.put ("hinted", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::hinted]));
 	info.put ("optimistic", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::optimistic]));
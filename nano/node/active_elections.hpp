@@ -19,6 +19,8 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -68,6 +70,7 @@ private: // Elections
 		nano::qualified_root root;
 		std::shared_ptr<nano::election> election;
 		erased_callback_t erased_callback;
+		uint64_t sequence; // Global insertion order, used to merge elections from all shards
 	};
 
 	friend class nano::election;
@@ -87,7 +90,22 @@ private: // Elections
 			mi::member<entry, nano::qualified_root, &entry::root>>
 	>>;
 	// clang-format on
-	ordered_roots roots;
+
+	/**
+	 * Elections are split by qualified root hash into independently locked shards, so that operations on unrelated roots do not contend
+	 */
+	class shard final
+	{
+	public:
+		ordered_roots roots;
+		mutable nano::mutex mutex{ mutex_identifier (mutexes::active) };
+	};
+
+	static std::size_t constexpr shard_count = 16;
+	std::array<shard, shard_count> shards;
+
+	shard & shard_for (nano::qualified_root const &);
+	shard const & shard_for (nano::qualified_root const &) const;
 
 public:
 	active_elections (nano::node &, nano::confirming_set &, nano::block_processor &);
@@ -130,16 +148,15 @@ public: // Events
 
 private:
 	void request_loop ();
-	void request_confirm (nano::unique_lock<nano::mutex> &);
+	void request_confirm ();
 	// Erase all blocks from active and, if not confirmed, clear digests from network filters
-	void cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election>);
+	void cleanup_election (shard &, nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election>);
 
 	using block_cemented_result = std::pair<nano::election_status, std::vector<nano::vote_with_weight_info>>;
 	block_cemented_result block_cemented (std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root, std::shared_ptr<nano::election> const & source_election);
 	void notify_observers (nano::secure::transaction const &, nano::election_status const & status, std::vector<nano::vote_with_weight_info> const & votes) const;
 
-	std::shared_ptr<nano::election> election_impl (nano::qualified_root const &) const;
-	std::vector<std::shared_ptr<nano::election>> list_active_impl (std::size_t max_count) const;
+	std::shared_ptr<nano::election> election_impl (shard const &, nano::qualified_root const &) const;
 
 private: // Dependencies
 	active_elections_config const & config;
@@ -153,14 +170,18 @@ public:
 
 	// TODO: This mutex is currently public because many tests access it
 	// TODO: This is bad. Remove the need to explicitly lock this from any code outside of this class
+	// Only synchronizes the request loop wakeups, elections are protected by their shard mutex
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::active) };
 
 private:
+	/** Total number of elections across all shards */
+	std::atomic<int64_t> count_total{ 0 };
 	/** Keeps track of number of elections by election behavior (normal, hinted, optimistic) */
-	nano::enum_array<nano::election_behavior, int64_t> count_by_behavior{};
+	nano::enum_array<nano::election_behavior, std::atomic<int64_t>> count_by_behavior{};
+	std::atomic<uint64_t> next_sequence{ 0 };
 
 	nano::condition_variable condition;
-	bool stopped{ false };
+	std::atomic<bool> stopped{ false };
 	std::thread thread;
 
 	friend class election;
@@ -11,6 +11,7 @@
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/store/component.hpp>
 
+#include <latch>
 #include <utility>
 
 /*
@@ -20,7 +21,8 @@
 nano::block_processor::block_processor (nano::node & node_a) :
 	config{ node_a.config.block_processor },
 	node{ node_a },
-	workers{ 1, nano::thread_role::name::block_processing_notifications }
+	workers{ 1, nano::thread_role::name::block_processing_notifications },
+	verifiers{ static_cast<unsigned> (config.verification_threads), nano::thread_role::name::signature_checking }
 {
 	batch_processed.add ([this] (auto const & items) {
 		// For every batch item: notify the 'processed' observer.
@@ -64,6 +66,7 @@ nano::block_processor::~block_processor ()
 	// Thread must be stopped before destruction
 	debug_assert (!thread.joinable ());
 	debug_assert (!workers.alive ());
+	debug_assert (!verifiers.alive ());
 }
 
 void nano::block_processor::start ()
@@ -71,6 +74,10 @@ void nano::block_processor::start ()
 	debug_assert (!thread.joinable ());
 
 	workers.start ();
+	if (config.verification_threads > 0)
+	{
+		verifiers.start ();
+	}
 
 	thread = std::thread ([this] () {
 		nano::thread_role::set (nano::thread_role::name::block_processing);
@@ -90,6 +97,8 @@ void nano::block_processor::stop ()
 		thread.join ();
 	}
 	workers.stop ();
+	// Verification tasks are only posted and awaited by the processing thread, safe to stop after it exits
+	verifiers.stop ();
 }
 
 // TODO: Remove and replace all checks with calls to size (block_source)
@@ -304,48 +313,87 @@ auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock
 
 	lock.unlock ();
 
-	auto transaction = node.ledger.tx_begin_write (nano::store::writer::blockprocessor);
+	// Expensive stateless checks are done before acquiring the write transaction to keep it as short as possible
+	verify_batch (batch);
+
+	processed_batch_t processed;
 
-	nano::timer<std::chrono::milliseconds> timer;
-	timer.start ();
+	// Blocks are written in a transaction that may be shared with other writers, returns once it is committed
+	// The shared transaction cannot be refreshed by a single writer, a batch taking too long is split across several submissions instead
+	auto next = batch.begin ();
+	auto process = [&] (secure::write_transaction & transaction) {
+		nano::timer<std::chrono::milliseconds> timer;
+		timer.start ();
 
-	// Processing blocks
-	size_t number_of_blocks_processed = 0;
-	size_t number_of_forced_processed = 0;
+		// Processing blocks
+		size_t number_of_blocks_processed = 0;
+		size_t number_of_forced_processed = 0;
 
-	processed_batch_t processed;
-	for (auto & ctx : batch)
-	{
-		auto const hash = ctx.block->hash ();
-		bool const force = ctx.source == nano::block_source::forced;
+		for (; next != batch.end () && timer.since_start () < nano::write_group::max_transaction_age; ++next)
+		{
+			auto & ctx = *next;
+			auto const hash = ctx.block->hash ();
+			bool const force = ctx.source == nano::block_source::forced;
+
+			if (force)
+			{
+				number_of_forced_processed++;
+				rollback_competitor (transaction, *ctx.block);
+			}
+
+			number_of_blocks_processed++;
 
-		transaction.refresh_if_needed ();
+			auto result = process_one (transaction, ctx, force);
+			processed.emplace_back (result, std::move (ctx));
+		}
 
-		if (force)
+		if (number_of_blocks_processed != 0 && timer.stop () > std::chrono::milliseconds (100))
 		{
-			number_of_forced_processed++;
-			rollback_competitor (transaction, *ctx.block);
+			node.logger.debug (nano::log::type::blockprocessor, "Processed {} blocks ({} forced) in {} {}", number_of_blocks_processed, number_of_forced_processed, timer.value ().count (), timer.unit ());
 		}
+	};
+
+	while (next != batch.end ())
+	{
+		node.ledger.write_group.submit (nano::store::writer::blockprocessor, process);
+	}
 
-		number_of_blocks_processed++;
+	return processed;
+}
 
-		auto result = process_one (transaction, ctx, force);
-		processed.emplace_back (result, std::move (ctx));
+void nano::block_processor::verify_batch (std::deque<context> & batch)
+{
+	if (config.verification_threads == 0 || batch.empty ())
+	{
+		return;
 	}
 
-	if (number_of_blocks_processed != 0 && timer.stop () > std::chrono::milliseconds (100))
+	auto const chunk_size = (batch.size () + config.verification_threads - 1) / config.verification_threads;
+	auto const chunks = (batch.size () + chunk_size - 1) / chunk_size;
+
+	std::latch done{ static_cast<std::ptrdiff_t> (chunks) };
+	for (size_t begin = 0; begin < batch.size (); begin += chunk_size)
 	{
-		node.logger.debug (nano::log::type::blockprocessor, "Processed {} blocks ({} forced) in {} {}", number_of_blocks_processed, number_of_forced_processed, timer.value ().count (), timer.unit ());
+		auto const end = std::min (begin + chunk_size, batch.size ());
+		verifiers.post ([this, &batch, &done, begin, end] () {
+			for (auto i = begin; i < end; ++i)
+			{
+				auto & ctx = batch[i];
+				ctx.verification = nano::block_verification::verify (*ctx.block, node.ledger.constants);
+			}
+			done.count_down ();
+		});
 	}
+	done.wait ();
 
-	return processed;
+	node.stats.add (nano::stat::type::blockprocessor, nano::stat::detail::verified, batch.size ());
 }
 
 nano::block_status nano::block_processor::process_one (secure::write_transaction const & transaction_a, context const & context, bool const forced_a)
 {
 	auto block = context.block;
 	auto const hash = block->hash ();
-	nano::block_status result = node.ledger.process (transaction_a, block);
+	nano::block_status result = node.ledger.process (transaction_a, block, context.verification);
 
 	node.stats.inc (nano::stat::type::blockprocessor_result, to_stat_detail (result));
 	node.stats.inc (nano::stat::type::blockprocessor_source, to_stat_detail (context.source));
@@ -452,6 +500,7 @@ nano::container_info nano::block_processor::container_info () const
 	info.put ("forced", queue.size ({ nano::block_source::forced }));
 	info.add ("queue", queue.container_info ());
 	info.add ("workers", workers.container_info ());
+	info.add ("verifiers", verifiers.container_info ());
 	return info;
 }
 
@@ -492,6 +541,7 @@ nano::error nano::block_processor_config::serialize (nano::tomlconfig & toml) co
 	toml.put ("priority_live", priority_live, "Priority for live network blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_bootstrap", priority_bootstrap, "Priority for bootstrap blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_local", priority_local, "Priority for local RPC blocks. Higher priority gets processed more frequently. \ntype:uint64");
+	toml.put ("verification_threads", verification_threads, "Number of threads used to check block signatures and work before blocks are written to the ledger. 0 disables pre-verification. \ntype:uint64");
 
 	return toml.get_error ();
 }
@@ -503,6 +553,7 @@ nano::error nano::block_processor_config::deserialize (nano::tomlconfig & toml)
 	toml.get ("priority_live", priority_live);
 	toml.get ("priority_bootstrap", priority_bootstrap);
 	toml.get ("priority_local", priority_local);
+	toml.get ("verification_threads", verification_threads);
 
 	return toml.get_error ();
 }
@@ -4,6 +4,7 @@
 #include <nano/lib/thread_pool.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/node/fwd.hpp>
+#include <nano/secure/block_verification.hpp>
 #include <nano/secure/common.hpp>
 
 #include <chrono>
@@ -50,6 +51,9 @@ public:
 
 	size_t batch_size{ 256 };
 	size_t max_queued_notifications{ 8 };
+
+	// Number of threads checking block signatures and work before the ledger write transaction is opened, 0 disables pre-verification
+	size_t verification_threads{ std::clamp (nano::hardware_concurrency () / 2, 1u, 4u) };
 };
 
 /**
@@ -71,6 +75,8 @@ public: // Context
 		nano::block_source source;
 		callback_t callback;
 		std::chrono::steady_clock::time_point arrival{ std::chrono::steady_clock::now () };
+		// Stateless checks done ahead of ledger processing, ledger skips re-checking them
+		nano::block_verification verification;
 
 		std::future<result_t> get_future ();
 
@@ -114,6 +120,8 @@ private:
 	nano::block_status process_one (secure::write_transaction const &, context const &, bool forced = false);
 	void queue_unchecked (secure::write_transaction const &, nano::hash_or_account const &);
 	processed_batch_t process_batch (nano::unique_lock<nano::mutex> &);
+	// Checks signatures and work of batch blocks in parallel, must be called without holding the ledger write transaction
+	void verify_batch (std::deque<context> &);
 	std::deque<context> next_batch (size_t max_count);
 	context next ();
 	bool add_impl (context, std::shared_ptr<nano::transport::channel> const & channel = nullptr);
@@ -131,5 +139,6 @@ private:
 	std::thread thread;
 
 	nano::thread_pool workers;
+	nano::thread_pool verifiers;
 };
 }
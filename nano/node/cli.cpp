@@ -112,6 +112,8 @@ void nano::add_node_flag_options (boost::program_options::options_description &
 		("disable_tcp_realtime", "Disables TCP realtime connections")
 		("disable_block_processor_republishing", "Disables block republishing by disabling the local_block_broadcaster component")
 		("disable_search_pending", "Disables the periodic search for pending transactions")
+		("disable_group_commit", "Disables sharing of ledger write transactions between the block processor and cementing")
+		("capture_traffic", boost::program_options::value<std::string>(), "Captures all inbound network messages to the given file, for replay with --debug_replay_traffic")
 		("enable_pruning", "Enable experimental ledger pruning")
 		("allow_bootstrap_peers_duplicates", "Allow multiple connections to same peer in bootstrap attempts")
 		("fast_bootstrap", "Increase bootstrap speed for high end nodes with higher limits")
@@ -144,6 +146,12 @@ std::error_code nano::update_flags (nano::node_flags & flags_a, boost::program_o
 	flags_a.disable_tcp_realtime = (vm.count ("disable_tcp_realtime") > 0);
 	flags_a.disable_block_processor_republishing = (vm.count ("disable_block_processor_republishing") > 0);
 	flags_a.disable_search_pending = (vm.count ("disable_search_pending") > 0);
+	flags_a.disable_group_commit = (vm.count ("disable_group_commit") > 0);
+	auto capture_traffic_it = vm.find ("capture_traffic");
+	if (capture_traffic_it != vm.end ())
+	{
+		flags_a.capture_traffic = capture_traffic_it->second.as<std::string> ();
+	}
 	if (!flags_a.inactive_node)
 	{
 		flags_a.disable_bootstrap_listener = (vm.count ("disable_bootstrap_listener") > 0);
@@ -35,6 +35,7 @@ bool nano::confirmation_solicitor::broadcast (nano::election const & election_a)
 	{
 		auto const & hash (election_a.status.winner->hash ());
 		nano::publish winner{ config.network_params.network, election_a.status.winner };
+		auto buffer = winner.to_shared_const_buffer ();
 		unsigned count = 0;
 		// Directed broadcasting to principal representatives
 		for (auto i (representatives_broadcasts.begin ()), n (representatives_broadcasts.end ()); i != n && count < max_election_broadcasts; ++i)
@@ -44,12 +45,12 @@ bool nano::confirmation_solicitor::broadcast (nano::election const & election_a)
 			bool const different (exists && existing->second.hash != hash);
 			if (!exists || different)
 			{
-				i->channel->send (winner);
+				i->channel->send (winner, buffer);
 				count += different ? 0 : 1;
 			}
 		}
 		// Random flood for block propagation
-		network.flood_message (winner, nano::transport::buffer_drop_policy::limiter, 0.5f);
+		network.flood_message (winner, buffer, nano::transport::buffer_drop_policy::limiter, 0.5f);
 		error = false;
 	}
 	return error;
@@ -167,35 +167,35 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 		});
 	};
 
-	// We might need to issue multiple notifications if the block we're confirming implicitly confirms more
-	auto notify_maybe = [this, &cemented, &already, &notify] (auto & transaction) {
-		if (cemented.size () >= config.max_blocks)
-		{
-			stats.inc (nano::stat::type::confirming_set, nano::stat::detail::notify_intermediate);
-			transaction.commit ();
-			notify ();
-			transaction.renew ();
-		}
-	};
-
-	{
-		auto transaction = ledger.tx_begin_write (nano::store::writer::confirmation_height);
-		for (auto const & [hash, election] : batch)
+	// Cementing happens in transactions that may be shared with other writers, notifications are only issued once a transaction is committed
+	auto next = batch.begin ();
+	size_t cemented_count = 0;
+	auto cement = [&] (secure::write_transaction & transaction) {
+		for (; next != batch.end (); ++next)
 		{
-			size_t cemented_count = 0;
+			auto const & [hash, election] = *next;
 			bool success = false;
 			do
 			{
-				transaction.refresh_if_needed ();
-
 				// Cementing deep dependency chains might take a long time, allow for graceful shutdown, ignore notifications
 				if (stopped)
 				{
 					return;
 				}
 
-				// Issue notifications here, so that `cemented` set is not too large before we add more blocks
-				notify_maybe (transaction);
+				// Hand the transaction back to be committed, so that `cemented` set is not too large before we add more blocks
+				// The same block continues cementing in the next transaction if confirming it implicitly confirms more
+				if (cemented.size () >= config.max_blocks)
+				{
+					stats.inc (nano::stat::type::confirming_set, nano::stat::detail::notify_intermediate);
+					return;
+				}
+
+				// Hand an old transaction back as well, it cannot be refreshed while shared with other writers
+				if (std::chrono::steady_clock::now () - transaction.timestamp () > nano::write_group::max_transaction_age)
+				{
+					return;
+				}
 
 				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cementing);
 
@@ -237,10 +237,24 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cementing_failed);
 				logger.debug (nano::log::type::confirming_set, "Failed to cement block: {}", hash.to_string ());
 			}
+			cemented_count = 0;
 		}
+	};
+
+	// We might need to issue multiple notifications if the block we're confirming implicitly confirms more
+	while (next != batch.end ())
+	{
+		ledger.write_group.submit (nano::store::writer::confirmation_height, cement);
+
+		// Cementing was interrupted by shutdown, ignore notifications
+		if (stopped)
+		{
+			return;
+		}
+
+		notify ();
 	}
 
-	notify ();
 	release_assert (cemented.empty ());
 
 	already_cemented.notify (already);
@@ -32,7 +32,9 @@ nano::election::election (nano::node & node_a, std::shared_ptr<nano::block> cons
 	root (block_a->root ()),
 	qualified_root (block_a->qualified_root ())
 {
-	last_votes.emplace (nano::account::null (), nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
+	nano::vote_info const initial{ std::chrono::steady_clock::now (), 0, block_a->hash () };
+	last_votes.emplace (nano::account::null (), initial);
+	tally_add (nano::account::null (), initial, node.ledger.weight (nano::account::null ()));
 	last_blocks.emplace (block_a->hash (), block_a);
 }
 
@@ -240,13 +242,17 @@ void nano::election::broadcast_vote ()
 nano::vote_info nano::election::get_last_vote (nano::account const & account)
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
+	if (!last_votes.contains (account))
+	{
+		vote_set (account, nano::vote_info{}, node.ledger.weight (account));
+	}
 	return last_votes[account];
 }
 
 void nano::election::set_last_vote (nano::account const & account, nano::vote_info vote_info)
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	last_votes[account] = vote_info;
+	vote_set (account, vote_info, node.ledger.weight (account));
 }
 
 nano::election_status nano::election::get_status () const
@@ -352,40 +358,96 @@ nano::tally_t nano::election::tally () const
 
 nano::tally_t nano::election::tally_impl () const
 {
-	std::unordered_map<nano::block_hash, nano::uint128_t> block_weights;
-	std::unordered_map<nano::block_hash, nano::uint128_t> final_weights_l;
-	for (auto const & [account, info] : last_votes)
+	if (std::chrono::steady_clock::now () - tally_refreshed >= tally_refresh_interval)
 	{
-		auto rep_weight (node.ledger.weight (account));
-		block_weights[info.hash] += rep_weight;
-		if (info.timestamp == std::numeric_limits<uint64_t>::max ())
-		{
-			final_weights_l[info.hash] += rep_weight;
-		}
+		tally_refresh ();
 	}
-	last_tally = block_weights;
 	nano::tally_t result;
-	for (auto const & [hash, amount] : block_weights)
+	for (auto const & [hash, entry] : tally_entries)
 	{
 		auto block (last_blocks.find (hash));
 		if (block != last_blocks.end ())
 		{
-			result.emplace (amount, block->second);
+			result.emplace (entry.weight, block->second);
 		}
 	}
 	// Calculate final votes sum for winner
-	if (!final_weights_l.empty () && !result.empty ())
+	if (!result.empty ())
 	{
 		auto winner_hash (result.begin ()->second->hash ());
-		auto find_final (final_weights_l.find (winner_hash));
-		if (find_final != final_weights_l.end ())
+		auto find_final (tally_entries.find (winner_hash));
+		if (find_final != tally_entries.end () && find_final->second.final_voters > 0)
 		{
-			final_weight = find_final->second;
+			final_weight = find_final->second.final_weight;
 		}
 	}
 	return result;
 }
 
+void nano::election::vote_set (nano::account const & account, nano::vote_info const & info, nano::uint128_t const & weight)
+{
+	debug_assert (!mutex.try_lock ());
+	tally_remove (account);
+	last_votes[account] = info;
+	tally_add (account, info, weight);
+}
+
+void nano::election::vote_erase (nano::account const & account)
+{
+	debug_assert (!mutex.try_lock ());
+	tally_remove (account);
+	last_votes.erase (account);
+}
+
+void nano::election::tally_add (nano::account const & account, nano::vote_info const & info, nano::uint128_t const & weight) const
+{
+	auto const is_final = nano::vote::is_final_timestamp (info.timestamp);
+	auto & entry = tally_entries[info.hash];
+	entry.weight += weight;
+	++entry.voters;
+	if (is_final)
+	{
+		entry.final_weight += weight;
+		++entry.final_voters;
+	}
+	counted_votes[account] = { info.hash, weight, is_final };
+}
+
+void nano::election::tally_remove (nano::account const & account) const
+{
+	auto counted = counted_votes.find (account);
+	if (counted == counted_votes.end ())
+	{
+		return;
+	}
+	auto existing = tally_entries.find (counted->second.hash);
+	release_assert (existing != tally_entries.end ());
+	auto & entry = existing->second;
+	entry.weight -= counted->second.weight;
+	--entry.voters;
+	if (counted->second.is_final)
+	{
+		entry.final_weight -= counted->second.weight;
+		--entry.final_voters;
+	}
+	if (entry.voters == 0)
+	{
+		tally_entries.erase (existing);
+	}
+	counted_votes.erase (counted);
+}
+
+void nano::election::tally_refresh () const
+{
+	tally_entries.clear ();
+	counted_votes.clear ();
+	for (auto const & [account, info] : last_votes)
+	{
+		tally_add (account, info, node.ledger.weight (account));
+	}
+	tally_refreshed = std::chrono::steady_clock::now ();
+}
+
 void nano::election::confirm_if_quorum (nano::unique_lock<nano::mutex> & lock_a)
 {
 	debug_assert (lock_a.owns_lock ());
@@ -485,7 +547,7 @@ nano::vote_code nano::election::vote (nano::account const & rep, uint64_t timest
 		}
 	}
 
-	last_votes[rep] = { std::chrono::steady_clock::now (), timestamp_a, block_hash_a };
+	vote_set (rep, { std::chrono::steady_clock::now (), timestamp_a, block_hash_a }, weight);
 	if (vote_source_a != vote_source::cache)
 	{
 		live_vote_action (rep);
@@ -630,7 +692,7 @@ void nano::election::remove_votes (nano::block_hash const & hash_a)
 		auto list_generated_votes (node.history.votes (root, hash_a));
 		for (auto const & vote : list_generated_votes)
 		{
-			last_votes.erase (vote->account);
+			vote_erase (vote->account);
 		}
 		// Clear votes cache
 		node.history.erase (root);
@@ -644,9 +706,18 @@ void nano::election::remove_block (nano::block_hash const & hash_a)
 	{
 		if (auto existing = last_blocks.find (hash_a); existing != last_blocks.end ())
 		{
-			erase_if (last_votes, [hash_a] (auto const & entry) {
-				return entry.second.hash == hash_a;
-			});
+			std::vector<nano::account> voters;
+			for (auto const & [account, info] : last_votes)
+			{
+				if (info.hash == hash_a)
+				{
+					voters.push_back (account);
+				}
+			}
+			for (auto const & account : voters)
+			{
+				vote_erase (account);
+			}
 
 			node.network.filter.clear (existing->second);
 			last_blocks.erase (hash_a);
@@ -661,8 +732,11 @@ bool nano::election::replace_by_weight (nano::unique_lock<nano::mutex> & lock_a,
 	auto winner_hash (status.winner->hash ());
 	// Sort existing blocks tally
 	std::vector<std::pair<nano::block_hash, nano::uint128_t>> sorted;
-	sorted.reserve (last_tally.size ());
-	std::copy (last_tally.begin (), last_tally.end (), std::back_inserter (sorted));
+	sorted.reserve (tally_entries.size ());
+	for (auto const & [hash, entry] : tally_entries)
+	{
+		sorted.emplace_back (hash, entry.weight);
+	}
 	lock_a.unlock ();
 
 	// Sort in ascending order
@@ -162,6 +162,13 @@ private:
 	void broadcast_vote_locked (nano::unique_lock<nano::mutex> & lock);
 	void remove_votes (nano::block_hash const &);
 	void remove_block (nano::block_hash const &);
+	/** Records the vote of a representative and updates the running tally. Requires mutex lock */
+	void vote_set (nano::account const &, nano::vote_info const &, nano::uint128_t const & weight);
+	void vote_erase (nano::account const &);
+	void tally_add (nano::account const &, nano::vote_info const &, nano::uint128_t const & weight) const;
+	void tally_remove (nano::account const &) const;
+	/** Recounts every vote with current representative weights, which change while the election is active */
+	void tally_refresh () const;
 	bool replace_by_weight (nano::unique_lock<nano::mutex> & lock_a, nano::block_hash const &);
 	std::chrono::milliseconds time_to_live () const;
 	/**
@@ -178,7 +185,27 @@ private:
 	std::unordered_map<nano::account, nano::vote_info> last_votes;
 	std::atomic<bool> is_quorum{ false };
 	mutable nano::uint128_t final_weight{ 0 };
-	mutable std::unordered_map<nano::block_hash, nano::uint128_t> last_tally;
+
+	class tally_entry final
+	{
+	public:
+		nano::uint128_t weight{ 0 };
+		nano::uint128_t final_weight{ 0 };
+		std::size_t voters{ 0 };
+		std::size_t final_voters{ 0 };
+	};
+	class counted_vote final
+	{
+	public:
+		nano::block_hash hash;
+		nano::uint128_t weight;
+		bool is_final;
+	};
+	/** Running vote weight per block, updated by delta whenever a vote is added, replaced or removed */
+	mutable std::unordered_map<nano::block_hash, tally_entry> tally_entries;
+	/** Contribution of each voter to `tally_entries` */
+	mutable std::unordered_map<nano::account, counted_vote> counted_votes;
+	mutable std::chrono::steady_clock::time_point tally_refreshed{ std::chrono::steady_clock::now () };
 
 	nano::election_behavior const behavior_m;
 	std::chrono::steady_clock::time_point const election_start{ std::chrono::steady_clock::now () };
@@ -190,6 +217,7 @@ public: // Logging
 
 private: // Constants
 	static std::size_t constexpr max_blocks{ 10 };
+	static std::chrono::seconds constexpr tally_refresh_interval{ 1 };
 
 	friend class active_elections;
 	friend class confirmation_solicitor;
@@ -35,6 +35,7 @@ ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ();
 auto ipc_json_handler_no_arg_funcs = create_ipc_json_handler_no_arg_func_map ();
 bool block_confirmed (nano::node & node, nano::secure::transaction & transaction, nano::block_hash const & hash, bool include_active, bool include_only_confirmed);
 char const * epoch_as_string (nano::epoch);
+nano::block_hash block_at_offset (nano::ledger & ledger, nano::secure::transaction const & transaction, nano::block const & block, uint64_t offset, bool successors);
 }
 
 nano::json_handler::json_handler (nano::node & node_a, nano::node_rpc_config const & node_rpc_config_a, std::string const & body_a, std::function<void (std::string const &)> const & response_a, std::function<void ()> stop_callback_a) :
@@ -885,25 +886,31 @@ void nano::json_handler::accounts_balances ()
 {
 	boost::property_tree::ptree balances;
 	boost::property_tree::ptree errors;
-	auto transaction = node.store.tx_begin_read ();
+	bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
+	std::vector<std::string> account_texts;
+	std::vector<nano::account> accounts;
 	for (auto & account_from_request : request.get_child ("accounts"))
 	{
-		boost::property_tree::ptree entry;
 		auto account = account_impl (account_from_request.second.data ());
 		if (!ec)
 		{
-			bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
-			auto balance = node.balance_pending (account, include_only_confirmed);
-			entry.put ("balance", balance.first.convert_to<std::string> ());
-			entry.put ("pending", balance.second.convert_to<std::string> ());
-			entry.put ("receivable", balance.second.convert_to<std::string> ());
-			balances.put_child (account_from_request.second.data (), entry);
+			account_texts.push_back (account_from_request.second.data ());
+			accounts.push_back (account);
 			continue;
 		}
 		debug_assert (ec);
 		errors.put (account_from_request.second.data (), ec.message ());
 		ec = {};
 	}
+	auto const balances_l = node.balances_pending (accounts, include_only_confirmed);
+	for (std::size_t i = 0; i < accounts.size (); ++i)
+	{
+		boost::property_tree::ptree entry;
+		entry.put ("balance", balances_l[i].first.convert_to<std::string> ());
+		entry.put ("pending", balances_l[i].second.convert_to<std::string> ());
+		entry.put ("receivable", balances_l[i].second.convert_to<std::string> ());
+		balances.put_child (account_texts[i], entry);
+	}
 	if (!balances.empty ())
 	{
 		response_l.add_child ("balances", balances);
@@ -1228,40 +1235,49 @@ void nano::json_handler::blocks ()
 	bool const json_block_l = request.get<bool> ("json_block", false);
 	boost::property_tree::ptree blocks;
 	auto transaction = node.ledger.tx_begin_read ();
+	// Decode hashes up to the first malformed one, their blocks are looked up in a single batch
+	std::vector<std::string> hash_texts;
+	std::vector<nano::block_hash> hashes_l;
+	bool bad_hash_number = false;
 	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
 	{
-		if (!ec)
+		nano::block_hash hash;
+		if (hash.decode_hex (hashes.second.data ()))
+		{
+			bad_hash_number = true;
+			break;
+		}
+		hash_texts.push_back (hashes.second.data ());
+		hashes_l.push_back (hash);
+	}
+	auto const blocks_l = node.ledger.any.block_get_multi (transaction, hashes_l);
+	for (std::size_t i = 0; i < hashes_l.size () && !ec; ++i)
+	{
+		auto const & hash_text = hash_texts[i];
+		auto const & block = blocks_l[i];
+		if (block != nullptr)
 		{
-			std::string hash_text = hashes.second.data ();
-			nano::block_hash hash;
-			if (!hash.decode_hex (hash_text))
+			if (json_block_l)
 			{
-				auto block = node.ledger.any.block_get (transaction, hash);
-				if (block != nullptr)
-				{
-					if (json_block_l)
-					{
-						boost::property_tree::ptree block_node_l;
-						block->serialize_json (block_node_l);
-						blocks.add_child (hash_text, block_node_l);
-					}
-					else
-					{
-						std::string contents;
-						block->serialize_json (contents);
-						blocks.put (hash_text, contents);
-					}
-				}
-				else
-				{
-					ec = nano::error_blocks::not_found;
-				}
+				boost::property_tree::ptree block_node_l;
+				block->serialize_json (block_node_l);
+				blocks.add_child (hash_text, block_node_l);
 			}
 			else
 			{
-				ec = nano::error_blocks::bad_hash_number;
+				std::string contents;
+				block->serialize_json (contents);
+				blocks.put (hash_text, contents);
 			}
 		}
+		else
+		{
+			ec = nano::error_blocks::not_found;
+		}
+	}
+	if (!ec && bad_hash_number)
+	{
+		ec = nano::error_blocks::bad_hash_number;
 	}
 	response_l.add_child ("blocks", blocks);
 	response_errors ();
@@ -1279,123 +1295,153 @@ void nano::json_handler::blocks_info ()
 	boost::property_tree::ptree blocks;
 	boost::property_tree::ptree blocks_not_found;
 	auto transaction = node.ledger.tx_begin_read ();
+	// Decode hashes up to the first malformed one, their blocks are looked up in a single batch
+	std::vector<std::string> hash_texts;
+	std::vector<nano::block_hash> hashes_l;
+	bool bad_hash_number = false;
 	for (boost::property_tree::ptree::value_type & hashes : request.get_child ("hashes"))
 	{
-		if (!ec)
+		nano::block_hash hash;
+		if (hash.decode_hex (hashes.second.data ()))
 		{
-			std::string hash_text = hashes.second.data ();
-			nano::block_hash hash;
-			if (!hash.decode_hex (hash_text))
+			bad_hash_number = true;
+			break;
+		}
+		hash_texts.push_back (hashes.second.data ());
+		hashes_l.push_back (hash);
+	}
+	auto const blocks_l = node.ledger.any.block_get_multi (transaction, hashes_l);
+	// Receivable entries of the send blocks are looked up in a single batch as well
+	std::vector<std::optional<nano::pending_info>> pending_l (blocks_l.size ());
+	if (receivable || receive_hash)
+	{
+		std::vector<std::size_t> sends;
+		std::vector<nano::pending_key> keys;
+		for (std::size_t i = 0; i < blocks_l.size (); ++i)
+		{
+			if (blocks_l[i] != nullptr && blocks_l[i]->is_send ())
 			{
-				auto block = node.ledger.any.block_get (transaction, hash);
-				if (block != nullptr)
+				sends.push_back (i);
+				keys.emplace_back (blocks_l[i]->destination (), hashes_l[i]);
+			}
+		}
+		auto const infos = node.ledger.any.pending_get_multi (transaction, keys);
+		for (std::size_t i = 0; i < sends.size (); ++i)
+		{
+			pending_l[sends[i]] = infos[i];
+		}
+	}
+	for (std::size_t i = 0; i < hashes_l.size () && !ec; ++i)
+	{
+		auto const & hash_text = hash_texts[i];
+		auto const & hash = hashes_l[i];
+		auto const & block = blocks_l[i];
+		if (block != nullptr)
+		{
+			boost::property_tree::ptree entry;
+			auto account = block->account ();
+			entry.put ("block_account", account.to_account ());
+			auto amount = node.ledger.any.block_amount (transaction, hash);
+			if (amount)
+			{
+				entry.put ("amount", amount.value ().number ().convert_to<std::string> ());
+			}
+			auto balance = block->balance ();
+			entry.put ("balance", balance.number ().convert_to<std::string> ());
+			entry.put ("height", std::to_string (block->sideband ().height));
+			entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
+			entry.put ("successor", block->sideband ().successor.to_string ());
+			auto confirmed (node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
+			entry.put ("confirmed", confirmed);
+
+			if (json_block_l)
+			{
+				boost::property_tree::ptree block_node_l;
+				block->serialize_json (block_node_l);
+				entry.add_child ("contents", block_node_l);
+			}
+			else
+			{
+				std::string contents;
+				block->serialize_json (contents);
+				entry.put ("contents", contents);
+			}
+			if (block->type () == nano::block_type::state)
+			{
+				auto subtype (nano::state_subtype (block->sideband ().details));
+				entry.put ("subtype", subtype);
+			}
+			if (receivable || receive_hash)
+			{
+				if (!block->is_send ())
 				{
-					boost::property_tree::ptree entry;
-					auto account = block->account ();
-					entry.put ("block_account", account.to_account ());
-					auto amount = node.ledger.any.block_amount (transaction, hash);
-					if (amount)
+					if (receivable)
 					{
-						entry.put ("amount", amount.value ().number ().convert_to<std::string> ());
+						entry.put ("pending", "0");
+						entry.put ("receivable", "0");
 					}
-					auto balance = block->balance ();
-					entry.put ("balance", balance.number ().convert_to<std::string> ());
-					entry.put ("height", std::to_string (block->sideband ().height));
-					entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
-					entry.put ("successor", block->sideband ().successor.to_string ());
-					auto confirmed (node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
-					entry.put ("confirmed", confirmed);
-
-					if (json_block_l)
+					if (receive_hash)
 					{
-						boost::property_tree::ptree block_node_l;
-						block->serialize_json (block_node_l);
-						entry.add_child ("contents", block_node_l);
+						entry.put ("receive_hash", nano::block_hash (0).to_string ());
 					}
-					else
+				}
+				else if (pending_l[i])
+				{
+					if (receivable)
 					{
-						std::string contents;
-						block->serialize_json (contents);
-						entry.put ("contents", contents);
+						entry.put ("pending", "1");
+						entry.put ("receivable", "1");
 					}
-					if (block->type () == nano::block_type::state)
+					if (receive_hash)
 					{
-						auto subtype (nano::state_subtype (block->sideband ().details));
-						entry.put ("subtype", subtype);
+						entry.put ("receive_hash", nano::block_hash (0).to_string ());
 					}
-					if (receivable || receive_hash)
+				}
+				else
+				{
+					if (receivable)
 					{
-						if (!block->is_send ())
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "0");
-								entry.put ("receivable", "0");
-							}
-							if (receive_hash)
-							{
-								entry.put ("receive_hash", nano::block_hash (0).to_string ());
-							}
-						}
-						else if (node.ledger.any.pending_get (transaction, nano::pending_key{ block->destination (), hash }))
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "1");
-								entry.put ("receivable", "1");
-							}
-							if (receive_hash)
-							{
-								entry.put ("receive_hash", nano::block_hash (0).to_string ());
-							}
-						}
-						else
-						{
-							if (receivable)
-							{
-								entry.put ("pending", "0");
-								entry.put ("receivable", "0");
-							}
-							if (receive_hash)
-							{
-								std::shared_ptr<nano::block> receive_block = node.ledger.find_receive_block_by_send_hash (transaction, block->destination (), hash);
-								std::string receive_hash = receive_block ? receive_block->hash ().to_string () : nano::block_hash (0).to_string ();
-								entry.put ("receive_hash", receive_hash);
-							}
-						}
+						entry.put ("pending", "0");
+						entry.put ("receivable", "0");
 					}
-					if (source)
+					if (receive_hash)
 					{
-						if (!block->is_receive () || !node.ledger.any.block_exists (transaction, block->source ()))
-						{
-							entry.put ("source_account", "0");
-						}
-						else
-						{
-							auto block_a = node.ledger.any.block_get (transaction, block->source ());
-							release_assert (block_a);
-							entry.put ("source_account", block_a->account ().to_account ());
-						}
+						std::shared_ptr<nano::block> receive_block = node.ledger.find_receive_block_by_send_hash (transaction, block->destination (), hash);
+						std::string receive_hash = receive_block ? receive_block->hash ().to_string () : nano::block_hash (0).to_string ();
+						entry.put ("receive_hash", receive_hash);
 					}
-					blocks.push_back (std::make_pair (hash_text, entry));
 				}
-				else if (include_not_found)
+			}
+			if (source)
+			{
+				if (!block->is_receive () || !node.ledger.any.block_exists (transaction, block->source ()))
 				{
-					boost::property_tree::ptree entry;
-					entry.put ("", hash_text);
-					blocks_not_found.push_back (std::make_pair ("", entry));
+					entry.put ("source_account", "0");
 				}
 				else
 				{
-					ec = nano::error_blocks::not_found;
+					auto block_a = node.ledger.any.block_get (transaction, block->source ());
+					release_assert (block_a);
+					entry.put ("source_account", block_a->account ().to_account ());
 				}
 			}
-			else
-			{
-				ec = nano::error_blocks::bad_hash_number;
-			}
+			blocks.push_back (std::make_pair (hash_text, entry));
+		}
+		else if (include_not_found)
+		{
+			boost::property_tree::ptree entry;
+			entry.put ("", hash_text);
+			blocks_not_found.push_back (std::make_pair ("", entry));
+		}
+		else
+		{
+			ec = nano::error_blocks::not_found;
 		}
 	}
+	if (!ec && bad_hash_number)
+	{
+		ec = nano::error_blocks::bad_hash_number;
+	}
 	if (!ec)
 	{
 		response_l.add_child ("blocks", blocks);
@@ -1856,21 +1902,22 @@ void nano::json_handler::chain (bool successors)
 	{
 		boost::property_tree::ptree blocks;
 		auto transaction = node.ledger.tx_begin_read ();
+		if (offset > 0)
+		{
+			if (auto block_l = node.ledger.any.block_get (transaction, hash))
+			{
+				hash = block_at_offset (node.ledger, transaction, *block_l, offset, successors);
+				offset = 0;
+			}
+		}
 		while (!hash.is_zero () && blocks.size () < count)
 		{
 			auto block_l = node.ledger.any.block_get (transaction, hash);
 			if (block_l != nullptr)
 			{
-				if (offset > 0)
-				{
-					--offset;
-				}
-				else
-				{
-					boost::property_tree::ptree entry;
-					entry.put ("", hash.to_string ());
-					blocks.push_back (std::make_pair ("", entry));
-				}
+				boost::property_tree::ptree entry;
+				entry.put ("", hash.to_string ());
+				blocks.push_back (std::make_pair ("", entry));
 				hash = successors ? node.ledger.any.block_successor (transaction, hash).value_or (0) : block_l->previous ();
 			}
 			else
@@ -2173,18 +2220,14 @@ void nano::json_handler::delegators ()
 	{
 		auto transaction (node.ledger.tx_begin_read ());
 		boost::property_tree::ptree delegators;
-		for (auto i (node.store.account.begin (transaction, start_account.number () + 1)), n (node.store.account.end (transaction)); i != n && delegators.size () < count; ++i)
+		for (auto i (node.ledger.any.delegator_upper_bound (transaction, representative, start_account)), n (node.ledger.any.delegator_end ()); i != n && delegators.size () < count; ++i)
 		{
-			nano::account_info const & info (i->second);
-			if (info.representative == representative)
+			auto const & [key, info] = *i;
+			if (info.balance.number () >= threshold.number ())
 			{
-				if (info.balance.number () >= threshold.number ())
-				{
-					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					nano::account const & delegator (i->first);
-					delegators.put (delegator.to_account (), balance);
-				}
+				std::string balance;
+				nano::uint128_union (info.balance).encode_dec (balance);
+				delegators.put (key.account.to_account (), balance);
 			}
 		}
 		response_l.add_child ("delegators", delegators);
@@ -2199,13 +2242,9 @@ void nano::json_handler::delegators_count ()
 	{
 		uint64_t count (0);
 		auto transaction (node.ledger.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction)), n (node.store.account.end (transaction)); i != n; ++i)
+		for (auto i (node.ledger.any.delegator_begin (transaction, account)), n (node.ledger.any.delegator_end ()); i != n; ++i)
 		{
-			nano::account_info const & info (i->second);
-			if (info.representative == account)
-			{
-				++count;
-			}
+			++count;
 		}
 		response_l.put ("count", std::to_string (count));
 	}
@@ -2598,31 +2637,30 @@ void nano::json_handler::account_history ()
 		bool output_raw (request.get_optional<bool> ("raw") == true);
 		response_l.put ("account", account.to_account ());
 		auto block = node.ledger.any.block_get (transaction, hash);
+		if (block != nullptr && offset > 0)
+		{
+			// Skipped blocks count towards the offset whether or not they pass the account filter
+			hash = block_at_offset (node.ledger, transaction, *block, offset, reverse);
+			block = node.ledger.any.block_get (transaction, hash);
+		}
 		while (block != nullptr && count > 0)
 		{
-			if (offset > 0)
-			{
-				--offset;
-			}
-			else
-			{
-				boost::property_tree::ptree entry;
-				history_visitor visitor (*this, output_raw, transaction, entry, hash, accounts_to_filter);
-				block->visit (visitor);
-				if (!entry.empty ())
+			boost::property_tree::ptree entry;
+			history_visitor visitor (*this, output_raw, transaction, entry, hash, accounts_to_filter);
+			block->visit (visitor);
+			if (!entry.empty ())
+			{
+				entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
+				entry.put ("height", std::to_string (block->sideband ().height));
+				entry.put ("hash", hash.to_string ());
+				entry.put ("confirmed", node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
+				if (output_raw)
 				{
-					entry.put ("local_timestamp", std::to_string (block->sideband ().timestamp));
-					entry.put ("height", std::to_string (block->sideband ().height));
-					entry.put ("hash", hash.to_string ());
-					entry.put ("confirmed", node.ledger.confirmed.block_exists_or_pruned (transaction, hash));
-					if (output_raw)
-					{
-						entry.put ("work", nano::to_string_hex (block->block_work ()));
-						entry.put ("signature", block->block_signature ().to_string ());
-					}
-					history.push_back (std::make_pair ("", entry));
-					--count;
+					entry.put ("work", nano::to_string_hex (block->block_work ()));
+					entry.put ("signature", block->block_signature ().to_string ());
 				}
+				history.push_back (std::make_pair ("", entry));
+				--count;
 			}
 			hash = reverse ? node.ledger.any.block_successor (transaction, hash).value_or (0) : block->previous ();
 			block = node.ledger.any.block_get (transaction, hash);
@@ -5397,4 +5435,15 @@ char const * epoch_as_string (nano::epoch epoch)
 			return "0";
 	}
 }
+
+/** Finds the block `offset` positions away from `block` in its account chain through the height index, instead of walking every block in between. Returns zero if that position is outside of the chain */
+nano::block_hash block_at_offset (nano::ledger & ledger, nano::secure::transaction const & transaction, nano::block const & block, uint64_t offset, bool successors)
+{
+	auto const height = block.sideband ().height;
+	if (successors ? offset > std::numeric_limits<uint64_t>::max () - height : offset >= height)
+	{
+		return 0;
+	}
+	return ledger.any.block_hash_at_height (transaction, block.account (), successors ? height + offset : height - offset).value_or (0);
+}
 }
@@ -291,6 +291,12 @@ void nano::message_processor::process (nano::message const & message, std::share
 	message.visit (visitor);
 }
 
+std::size_t nano::message_processor::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return queue.size ();
+}
+
 nano::container_info nano::message_processor::container_info () const
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
@@ -36,6 +36,9 @@ public:
 	bool put (std::unique_ptr<nano::message>, std::shared_ptr<nano::transport::channel> const &);
 	void process (nano::message const &, std::shared_ptr<nano::transport::channel> const &);
 
+	/** Number of queued messages, across all channels */
+	std::size_t size () const;
+
 	nano::container_info container_info () const;
 
 private:
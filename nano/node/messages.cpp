@@ -337,9 +337,23 @@ std::shared_ptr<std::vector<uint8_t>> nano::message::to_bytes () const
 
 nano::shared_const_buffer nano::message::to_shared_const_buffer () const
 {
+	if (auto payload = wire_payload ())
+	{
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream (bytes);
+			header.serialize (stream);
+		}
+		return shared_const_buffer (std::move (bytes), payload);
+	}
 	return shared_const_buffer (to_bytes ());
 }
 
+std::shared_ptr<std::vector<uint8_t> const> nano::message::wire_payload () const
+{
+	return nullptr;
+}
+
 nano::message_type nano::message::type () const
 {
 	return header.type;
@@ -451,6 +465,12 @@ void nano::publish::serialize (nano::stream & stream_a) const
 	block->serialize (stream_a);
 }
 
+std::shared_ptr<std::vector<uint8_t> const> nano::publish::wire_payload () const
+{
+	debug_assert (block != nullptr);
+	return block->wire_bytes ();
+}
+
 bool nano::publish::deserialize (nano::stream & stream_a, nano::block_uniquer * uniquer_a)
 {
 	debug_assert (header.type == nano::message_type::publish);
@@ -654,6 +674,11 @@ void nano::confirm_ack::serialize (nano::stream & stream_a) const
 	vote->serialize (stream_a);
 }
 
+std::shared_ptr<std::vector<uint8_t> const> nano::confirm_ack::wire_payload () const
+{
+	return vote->wire_bytes ();
+}
+
 bool nano::confirm_ack::operator== (nano::confirm_ack const & other_a) const
 {
 	auto result (*vote == *other_a.vote);
@@ -148,10 +148,15 @@ public:
 	virtual void serialize (nano::stream &) const = 0;
 	virtual void visit (nano::message_visitor &) const = 0;
 	std::shared_ptr<std::vector<uint8_t>> to_bytes () const;
+	/** Reuses the payload bytes returned by `wire_payload ()' when available, only the header is serialized */
 	nano::shared_const_buffer to_shared_const_buffer () const;
 
 	nano::message_type type () const;
 
+protected:
+	/** Payload as previously serialized, messages relaying objects received from the network can skip serializing them */
+	virtual std::shared_ptr<std::vector<uint8_t> const> wire_payload () const;
+
 public:
 	nano::message_header header;
 
@@ -206,6 +211,9 @@ public:
 	static uint8_t constexpr originator_flag = 2; // 0x0004
 	bool is_originator () const;
 
+protected:
+	std::shared_ptr<std::vector<uint8_t> const> wire_payload () const override;
+
 public: // Payload
 	std::shared_ptr<nano::block> block;
 
@@ -285,6 +293,9 @@ public:
 	static uint8_t constexpr rebroadcasted_flag = 2; // 0x0004
 	bool is_rebroadcasted () const;
 
+protected:
+	std::shared_ptr<std::vector<uint8_t> const> wire_payload () const override;
+
 private:
 	static uint8_t hash_count (nano::message_header const &);
 
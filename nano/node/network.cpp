@@ -231,10 +231,16 @@ void nano::network::send_keepalive_self (std::shared_ptr<nano::transport::channe
 }
 
 void nano::network::flood_message (nano::message & message_a, nano::transport::buffer_drop_policy const drop_policy_a, float const scale_a)
+{
+	// Serialize once, all channels share the same buffer
+	flood_message (message_a, message_a.to_shared_const_buffer (), drop_policy_a, scale_a);
+}
+
+void nano::network::flood_message (nano::message & message_a, nano::shared_const_buffer const & buffer, nano::transport::buffer_drop_policy const drop_policy_a, float const scale_a)
 {
 	for (auto & i : list (fanout (scale_a)))
 	{
-		i->send (message_a, nullptr, drop_policy_a);
+		i->send (message_a, buffer, nullptr, drop_policy_a);
 	}
 }
 
@@ -261,40 +267,44 @@ void nano::network::flood_block (std::shared_ptr<nano::block> const & block, nan
 void nano::network::flood_block_initial (std::shared_ptr<nano::block> const & block)
 {
 	nano::publish message{ node.network_params.network, block, /* is_originator */ true };
+	auto buffer = message.to_shared_const_buffer ();
 	for (auto const & rep : node.rep_crawler.principal_representatives ())
 	{
-		rep.channel->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		rep.channel->send (message, buffer, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 	for (auto & peer : list_non_pr (fanout (1.0)))
 	{
-		peer->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		peer->send (message, buffer, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 }
 
 void nano::network::flood_vote (std::shared_ptr<nano::vote> const & vote, float scale, bool rebroadcasted)
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
+	auto buffer = message.to_shared_const_buffer ();
 	for (auto & i : list (fanout (scale)))
 	{
-		i->send (message, nullptr);
+		i->send (message, buffer, nullptr);
 	}
 }
 
 void nano::network::flood_vote_non_pr (std::shared_ptr<nano::vote> const & vote, float scale, bool rebroadcasted)
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
+	auto buffer = message.to_shared_const_buffer ();
 	for (auto & i : list_non_pr (fanout (scale)))
 	{
-		i->send (message, nullptr);
+		i->send (message, buffer, nullptr);
 	}
 }
 
 void nano::network::flood_vote_pr (std::shared_ptr<nano::vote> const & vote, bool rebroadcasted)
 {
 	nano::confirm_ack message{ node.network_params.network, vote, rebroadcasted };
+	auto buffer = message.to_shared_const_buffer ();
 	for (auto const & i : node.rep_crawler.principal_representatives ())
 	{
-		i.channel->send (message, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
+		i.channel->send (message, buffer, nullptr, nano::transport::buffer_drop_policy::no_limiter_drop);
 	}
 }
 
@@ -91,6 +91,8 @@ public:
 	void stop ();
 
 	void flood_message (nano::message &, nano::transport::buffer_drop_policy const = nano::transport::buffer_drop_policy::limiter, float const = 1.0f);
+	// Floods a message that is already serialized into `buffer`, sharing the buffer between all channels
+	void flood_message (nano::message &, nano::shared_const_buffer const & buffer, nano::transport::buffer_drop_policy const = nano::transport::buffer_drop_policy::limiter, float const = 1.0f);
 	void flood_keepalive (float const scale_a = 1.0f);
 	void flood_keepalive_self (float const scale_a = 0.5f);
 	void flood_vote (std::shared_ptr<nano::vote> const &, float scale, bool rebroadcasted = false);
@@ -33,6 +33,7 @@
 #include <nano/node/scheduler/priority.hpp>
 #include <nano/node/telemetry.hpp>
 #include <nano/node/transport/tcp_listener.hpp>
+#include <nano/node/transport/traffic_capture.hpp>
 #include <nano/node/vote_generator.hpp>
 #include <nano/node/vote_processor.hpp>
 #include <nano/node/vote_router.hpp>
@@ -82,6 +83,7 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	logger{ make_logger_identifier (node_id) },
 	runner_impl{ std::make_unique<nano::thread_runner> (io_ctx_shared, logger, config.io_threads) },
 	runner{ *runner_impl },
+	connection_io_pool{ config.connection_io_threads > 0 ? std::make_unique<nano::io_context_pool> (config.connection_io_threads, logger) : nullptr },
 	node_initialized_latch (1),
 	network_params{ config.network_params },
 	stats{ logger, config.stats_config },
@@ -97,10 +99,10 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	distributed_work (*this),
 	store_impl (nano::make_store (logger, application_path_a, network_params.ledger, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade)),
 	store (*store_impl),
-	unchecked{ config.max_unchecked_blocks, stats, flags.disable_block_processor_unchecked_deletion },
+	unchecked{ config.max_unchecked_blocks, stats, flags.disable_block_processor_unchecked_deletion, config.max_unchecked_memory },
 	wallets_store_impl (std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config)),
 	wallets_store (*wallets_store_impl),
-	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number ()) },
+	ledger_impl{ std::make_unique<nano::ledger> (store, stats, network_params.ledger, flags_a.generate_cache, config_a.representative_vote_weight_minimum.number (), config_a.block_cache) },
 	ledger{ *ledger_impl },
 	outbound_limiter_impl{ std::make_unique<nano::bandwidth_limiter> (config) },
 	outbound_limiter{ *outbound_limiter_impl },
@@ -333,6 +335,12 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 			store.initialize (transaction, ledger.cache, ledger.constants);
 		}
 
+		if (flags.inactive_node && !flags.read_only)
+		{
+			// CLI commands may modify ledger tables directly, bypassing the ledger cache
+			ledger.cache_snapshot_discard ();
+		}
+
 		if (!block_or_pruned_exists (config.network_params.ledger.genesis->hash ()))
 		{
 			logger.critical (nano::log::type::node, "Genesis block not found. This commonly indicates a configuration issue, check that the --network or --data_path command line arguments are correct, and also the ledger backend node config option. If using a read-only CLI command a ledger must already exist, start the node with --daemon first.");
@@ -394,6 +402,17 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 			}
 		}
 
+		ledger.write_group.enabled = !flags.disable_group_commit;
+		if (!flags.capture_traffic.empty ())
+		{
+			traffic_recorder = std::make_shared<nano::transport::traffic_recorder> (flags.capture_traffic, network_params.network);
+			if (traffic_recorder->init_error ())
+			{
+				logger.critical (nano::log::type::node, "Unable to create traffic capture file: {}", flags.capture_traffic.string ());
+				std::exit (1);
+			}
+			logger.warn (nano::log::type::node, "Capturing inbound network traffic to: {}", flags.capture_traffic.string ());
+		}
 		ledger.pruning = flags.enable_pruning || store.pruned.count (store.tx_begin_read ()) > 0;
 
 		if (ledger.pruning)
@@ -582,6 +601,11 @@ void nano::node::start ()
 
 	ongoing_online_weight_calculation_queue ();
 
+	if (config.cache_snapshot_interval.count () > 0 && !flags.read_only)
+	{
+		ongoing_cache_snapshot ();
+	}
+
 	bool tcp_enabled = false;
 	if (config.tcp_incoming_connections_max > 0 && !(flags.disable_bootstrap_listener && flags.disable_tcp_realtime))
 	{
@@ -687,9 +711,25 @@ void nano::node::stop ()
 	election_workers.stop ();
 	workers.stop ();
 
+	// All ledger writers are stopped, persist the ledger cache so the next startup can skip rebuilding it
+	if (!init_error () && !flags.read_only && !flags.inactive_node)
+	{
+		ledger.cache_snapshot_write ();
+	}
+
+	if (traffic_recorder)
+	{
+		traffic_recorder->flush ();
+		logger.info (nano::log::type::node, "Captured {} inbound messages", traffic_recorder->recorded ());
+	}
+
 	// work pool is not stopped on purpose due to testing setup
 
-	// Stop the IO runner last
+	// Stop the IO runners last
+	if (connection_io_pool)
+	{
+		connection_io_pool->join ();
+	}
 	runner.join ();
 	debug_assert (io_ctx_shared.use_count () == 1); // Node should be the last user of the io_context
 }
@@ -727,10 +767,37 @@ bool nano::node::block_or_pruned_exists (nano::block_hash const & hash_a) const
 
 std::pair<nano::uint128_t, nano::uint128_t> nano::node::balance_pending (nano::account const & account_a, bool only_confirmed_a)
 {
-	std::pair<nano::uint128_t, nano::uint128_t> result;
+	return balances_pending ({ account_a }, only_confirmed_a).front ();
+}
+
+std::vector<std::pair<nano::uint128_t, nano::uint128_t>> nano::node::balances_pending (std::vector<nano::account> const & accounts_a, bool only_confirmed_a)
+{
 	auto const transaction = ledger.tx_begin_read ();
-	result.first = only_confirmed_a ? ledger.confirmed.account_balance (transaction, account_a).value_or (0).number () : ledger.any.account_balance (transaction, account_a).value_or (0).number ();
-	result.second = ledger.account_receivable (transaction, account_a, only_confirmed_a);
+	// Balances are read from the head blocks, heads and their blocks are each looked up in a single batch
+	std::vector<nano::block_hash> heads;
+	heads.reserve (accounts_a.size ());
+	if (only_confirmed_a)
+	{
+		for (auto const & account : accounts_a)
+		{
+			heads.push_back (ledger.confirmed.account_head (transaction, account));
+		}
+	}
+	else
+	{
+		for (auto const & info : ledger.any.account_get_multi (transaction, accounts_a))
+		{
+			heads.push_back (info ? info->head : nano::block_hash{ 0 });
+		}
+	}
+	auto const head_blocks = ledger.any.block_get_multi (transaction, heads);
+	std::vector<std::pair<nano::uint128_t, nano::uint128_t>> result;
+	result.reserve (accounts_a.size ());
+	for (std::size_t i = 0; i < accounts_a.size (); ++i)
+	{
+		auto const balance = head_blocks[i] ? head_blocks[i]->balance ().number () : nano::uint128_t{ 0 };
+		result.emplace_back (balance, ledger.account_receivable (transaction, accounts_a[i], only_confirmed_a));
+	}
 	return result;
 }
 
@@ -1056,6 +1123,18 @@ void nano::node::ongoing_online_weight_calculation ()
 	ongoing_online_weight_calculation_queue ();
 }
 
+void nano::node::ongoing_cache_snapshot ()
+{
+	std::weak_ptr<nano::node> node_w (shared_from_this ());
+	workers.post_delayed (config.cache_snapshot_interval, [node_w] () {
+		if (auto node_l = node_w.lock ())
+		{
+			node_l->ledger.cache_snapshot_write ();
+			node_l->ongoing_cache_snapshot ();
+		}
+	});
+}
+
 // TODO: Replace this with a queue of some sort. Blocks submitted here could be in a limbo for a while: neither part of an active election nor cemented
 void nano::node::process_confirmed (nano::block_hash hash, std::shared_ptr<nano::election> election, uint64_t iteration)
 {
@@ -1094,6 +1173,11 @@ std::shared_ptr<nano::node> nano::node::shared ()
 	return shared_from_this ();
 }
 
+boost::asio::io_context & nano::node::connection_io_ctx ()
+{
+	return connection_io_pool ? connection_io_pool->next () : io_ctx;
+}
+
 int nano::node::store_version ()
 {
 	auto transaction (store.tx_begin_read ());
@@ -47,6 +47,7 @@ class vote_router;
 class work_pool;
 class peer_history;
 class port_mapping;
+class io_context_pool;
 class thread_runner;
 
 namespace scheduler
@@ -56,6 +57,7 @@ namespace scheduler
 namespace transport
 {
 	class tcp_listener;
+	class traffic_recorder;
 }
 namespace rocksdb
 {
@@ -76,6 +78,8 @@ public:
 	void stop ();
 
 	std::shared_ptr<nano::node> shared ();
+	/** Context to bind a new peer connection to, either the shared io_context or a pinned one if `connection_io_threads` is configured */
+	boost::asio::io_context & connection_io_ctx ();
 
 	template <typename T>
 	void background (T action_a)
@@ -95,6 +99,8 @@ public:
 	std::shared_ptr<nano::block> block (nano::block_hash const &);
 	bool block_or_pruned_exists (nano::block_hash const &) const;
 	std::pair<nano::uint128_t, nano::uint128_t> balance_pending (nano::account const &, bool only_confirmed);
+	/** Batched `balance_pending`, entries are in the same order as the accounts */
+	std::vector<std::pair<nano::uint128_t, nano::uint128_t>> balances_pending (std::vector<nano::account> const &, bool only_confirmed);
 	nano::uint128_t weight (nano::account const &);
 	nano::uint128_t minimum_principal_weight ();
 	void backup_wallet ();
@@ -123,6 +129,7 @@ public:
 	void do_rpc_callback (boost::asio::ip::tcp::resolver::iterator i_a, std::string const &, uint16_t, std::shared_ptr<std::string> const &, std::shared_ptr<std::string> const &, std::shared_ptr<boost::asio::ip::tcp::resolver> const &);
 	void ongoing_online_weight_calculation ();
 	void ongoing_online_weight_calculation_queue ();
+	void ongoing_cache_snapshot ();
 	bool online () const;
 	bool init_error () const;
 	std::pair<uint64_t, std::unordered_map<nano::account, nano::uint128_t>> get_bootstrap_weights () const;
@@ -144,6 +151,8 @@ public:
 	nano::logger logger;
 	std::unique_ptr<nano::thread_runner> runner_impl;
 	nano::thread_runner & runner;
+	/** Empty unless `connection_io_threads` is configured */
+	std::unique_ptr<nano::io_context_pool> connection_io_pool;
 	boost::latch node_initialized_latch;
 	nano::network_params & network_params;
 	nano::stats stats;
@@ -173,6 +182,8 @@ public:
 	nano::telemetry & telemetry;
 	std::unique_ptr<nano::transport::tcp_listener> tcp_listener_impl;
 	nano::transport::tcp_listener & tcp_listener;
+	/** Set when inbound traffic is captured to a file, see node_flags::capture_traffic */
+	std::shared_ptr<nano::transport::traffic_recorder> traffic_recorder;
 	std::filesystem::path application_path;
 	nano::node_observers observers;
 	std::unique_ptr<nano::port_mapping> port_mapping_impl;
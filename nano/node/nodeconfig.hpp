@@ -30,10 +30,12 @@
 #include <nano/node/vote_cache.hpp>
 #include <nano/node/vote_processor.hpp>
 #include <nano/node/websocketconfig.hpp>
+#include <nano/secure/block_cache.hpp>
 #include <nano/secure/common.hpp>
 #include <nano/secure/generate_cache_flags.hpp>
 
 #include <chrono>
+#include <filesystem>
 #include <optional>
 #include <vector>
 
@@ -81,6 +83,8 @@ public:
 	nano::amount representative_vote_weight_minimum{ 10 * nano::nano_ratio };
 	unsigned password_fanout{ 1024 };
 	unsigned io_threads{ env_io_threads ().value_or (std::max (4u, nano::hardware_concurrency ())) };
+	/** Number of single threaded io_contexts peer connections are pinned to, zero keeps connections on the shared io_context */
+	unsigned connection_io_threads{ 0 };
 	unsigned network_threads{ std::max (4u, nano::hardware_concurrency ()) };
 	unsigned work_threads{ std::max (4u, nano::hardware_concurrency ()) };
 	unsigned background_threads{ std::max (4u, nano::hardware_concurrency ()) };
@@ -104,6 +108,7 @@ public:
 	uint16_t external_port{ 0 };
 	std::chrono::milliseconds block_processor_batch_max_time{ std::chrono::milliseconds (500) };
 	std::chrono::seconds unchecked_cutoff_time{ std::chrono::seconds (4 * 60 * 60) }; // 4 hours
+	std::chrono::seconds cache_snapshot_interval{ std::chrono::seconds (5 * 60) }; // Zero disables periodic ledger cache snapshots
 	/** Timeout for initiated async operations */
 	std::chrono::seconds tcp_io_timeout{ (network_params.network.is_dev_network () && !is_sanitizer_build ()) ? std::chrono::seconds (5) : std::chrono::seconds (15) };
 	std::chrono::nanoseconds pow_sleep_interval{ 0 };
@@ -128,12 +133,15 @@ public:
 	uint32_t max_queued_requests{ 512 };
 	unsigned request_aggregator_threads{ std::min (nano::hardware_concurrency (), 4u) }; // Max 4 threads if available
 	unsigned max_unchecked_blocks{ 65536 };
+	/** Maximum memory used by unchecked blocks, in bytes */
+	std::size_t max_unchecked_memory{ 64 * 1024 * 1024 };
 	std::chrono::seconds max_pruning_age{ !network_params.network.is_beta_network () ? std::chrono::seconds (24 * 60 * 60) : std::chrono::seconds (5 * 60) }; // 1 day; 5 minutes for beta network
 	uint64_t max_pruning_depth{ 0 };
 	nano::rocksdb_config rocksdb_config;
 	nano::lmdb_config lmdb_config;
 	bool enable_upnp{ true };
 	nano::vote_cache_config vote_cache;
+	nano::block_cache_config block_cache;
 	nano::rep_crawler_config rep_crawler;
 	nano::block_processor_config block_processor;
 	nano::active_elections_config active_elections;
@@ -181,6 +189,9 @@ public:
 	bool disable_max_peers_per_ip{ false }; // For testing only
 	bool disable_max_peers_per_subnetwork{ false }; // For testing only
 	bool disable_search_pending{ false }; // For testing only
+	bool disable_group_commit{ false };
+	/** When set, the raw inbound message stream of every connection is written to this file, see `--debug_replay_traffic` */
+	std::filesystem::path capture_traffic;
 	bool enable_pruning{ false };
 	bool fast_bootstrap{ false };
 	bool read_only{ false };
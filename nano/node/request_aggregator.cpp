@@ -214,10 +214,21 @@ auto nano::request_aggregator::aggregate (nano::secure::transaction const & tran
 {
 	std::vector<std::shared_ptr<nano::block>> to_generate;
 	std::vector<std::shared_ptr<nano::block>> to_generate_final;
+
+	// Ledger by hash, looked up in a single batch
+	std::vector<nano::block_hash> hashes;
+	hashes.reserve (requests_a.size ());
 	for (auto const & [hash, root] : requests_a)
 	{
-		// Ledger by hash
-		std::shared_ptr<nano::block> block = ledger.any.block_get (transaction, hash);
+		hashes.push_back (hash);
+	}
+	auto blocks = ledger.any.block_get_multi (transaction, hashes);
+	debug_assert (blocks.size () == requests_a.size ());
+
+	for (std::size_t i = 0; i < requests_a.size (); ++i)
+	{
+		auto const & root = requests_a[i].second;
+		std::shared_ptr<nano::block> block = blocks[i];
 
 		// Ledger by root
 		if (!block && !root.is_zero ())
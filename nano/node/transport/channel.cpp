@@ -16,8 +16,11 @@ nano::transport::channel::channel (nano::node & node_a) :
 
 void nano::transport::channel::send (nano::message & message_a, std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a, nano::transport::buffer_drop_policy drop_policy_a, nano::transport::traffic_type traffic_type)
 {
-	auto buffer = message_a.to_shared_const_buffer ();
+	send (message_a, message_a.to_shared_const_buffer (), callback_a, drop_policy_a, traffic_type);
+}
 
+void nano::transport::channel::send (nano::message & message_a, nano::shared_const_buffer const & buffer, std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a, nano::transport::buffer_drop_policy drop_policy_a, nano::transport::traffic_type traffic_type)
+{
 	bool is_droppable_by_limiter = (drop_policy_a == nano::transport::buffer_drop_policy::limiter);
 	bool should_pass = node.outbound_limiter.should_pass (buffer.size (), traffic_type);
 	bool pass = !is_droppable_by_limiter || should_pass;
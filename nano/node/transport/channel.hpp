@@ -31,6 +31,17 @@ public:
 	nano::transport::buffer_drop_policy policy_a = nano::transport::buffer_drop_policy::limiter,
 	nano::transport::traffic_type = nano::transport::traffic_type::generic);
 
+	/**
+	 * Sends an already serialized message. Used when the same message is broadcast to many channels,
+	 * so it is serialized once and every channel shares the same immutable buffer.
+	 * @param buffer must be the serialization of message_a, which is only used for stats and logging
+	 */
+	void send (nano::message & message_a,
+	nano::shared_const_buffer const & buffer,
+	std::function<void (boost::system::error_code const &, std::size_t)> const & callback_a = nullptr,
+	nano::transport::buffer_drop_policy policy_a = nano::transport::buffer_drop_policy::limiter,
+	nano::transport::traffic_type = nano::transport::traffic_type::generic);
+
 	// TODO: investigate clang-tidy warning about default parameters on virtual/override functions
 	virtual void send_buffer (nano::shared_const_buffer const &,
 	std::function<void (boost::system::error_code const &, std::size_t)> const & = nullptr,
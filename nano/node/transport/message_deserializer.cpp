@@ -1,6 +1,9 @@
 #include <nano/lib/enum_util.hpp>
 #include <nano/node/node.hpp>
 #include <nano/node/transport/message_deserializer.hpp>
+#include <nano/secure/vote.hpp>
+
+#include <cstring>
 
 nano::transport::message_deserializer::message_deserializer (nano::network_constants const & network_constants_a, nano::network_filter & network_filter_a, nano::block_uniquer & block_uniquer_a, nano::vote_uniquer & vote_uniquer_a,
 read_query read_op) :
@@ -12,7 +15,7 @@ read_query read_op) :
 	read_op{ std::move (read_op) }
 {
 	debug_assert (this->read_op);
-	read_buffer->resize (MAX_MESSAGE_SIZE);
+	read_buffer->resize (READ_BUFFER_SIZE);
 }
 
 void nano::transport::message_deserializer::read (const nano::transport::message_deserializer::callback_type && callback)
@@ -22,6 +25,17 @@ void nano::transport::message_deserializer::read (const nano::transport::message
 
 	status = parse_status::none;
 
+	if (read_some)
+	{
+		debug_assert (!pending);
+		pending = std::move (callback);
+		if (!delivering)
+		{
+			process_buffered ();
+		}
+		return;
+	}
+
 	read_op (read_buffer, HEADER_SIZE, [this_l = shared_from_this (), callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
 		if (ec)
 		{
@@ -48,38 +62,19 @@ void nano::transport::message_deserializer::received_header (const nano::transpo
 		callback (boost::asio::error::fault, nullptr);
 		return;
 	}
-	if (header.network != network_constants_m.current_network)
-	{
-		status = parse_status::invalid_network;
-		callback (boost::asio::error::fault, nullptr);
-		return;
-	}
-	if (header.version_using < network_constants_m.protocol_version_min)
-	{
-		status = parse_status::outdated_version;
-		callback (boost::asio::error::fault, nullptr);
-		return;
-	}
-	if (!header.is_valid_message_type ())
+	if (!validate (header))
 	{
-		status = parse_status::invalid_header;
 		callback (boost::asio::error::fault, nullptr);
 		return;
 	}
 
 	std::size_t payload_size = header.payload_length_bytes ();
-	if (payload_size > MAX_MESSAGE_SIZE)
-	{
-		status = parse_status::message_size_too_big;
-		callback (boost::asio::error::fault, nullptr);
-		return;
-	}
 	debug_assert (payload_size <= read_buffer->capacity ());
 
 	if (payload_size == 0)
 	{
 		// Payload size will be 0 for `bulk_push` & `telemetry_req` message type
-		received_message (header, 0, std::move (callback));
+		received_message (header, read_buffer->data (), 0, std::move (callback));
 	}
 	else
 	{
@@ -95,14 +90,112 @@ void nano::transport::message_deserializer::received_header (const nano::transpo
 				callback (boost::asio::error::fault, nullptr);
 				return;
 			}
-			this_l->received_message (header, size_a, std::move (callback));
+			this_l->received_message (header, this_l->read_buffer->data (), size_a, std::move (callback));
+		});
+	}
+}
+
+bool nano::transport::message_deserializer::validate (nano::message_header const & header)
+{
+	if (header.network != network_constants_m.current_network)
+	{
+		status = parse_status::invalid_network;
+		return false;
+	}
+	if (header.version_using < network_constants_m.protocol_version_min)
+	{
+		status = parse_status::outdated_version;
+		return false;
+	}
+	if (!header.is_valid_message_type ())
+	{
+		status = parse_status::invalid_header;
+		return false;
+	}
+	if (header.payload_length_bytes () > MAX_MESSAGE_SIZE)
+	{
+		status = parse_status::message_size_too_big;
+		return false;
+	}
+	return true;
+}
+
+void nano::transport::message_deserializer::process_buffered ()
+{
+	debug_assert (read_some);
+	auto this_l = shared_from_this (); // Callbacks might release the last reference to this deserializer
+
+	while (pending)
+	{
+		auto callback = std::move (*pending);
+		pending.reset ();
+
+		auto const available = buffer_end - buffer_begin;
+		std::size_t needed = HEADER_SIZE;
+		if (available >= HEADER_SIZE)
+		{
+			nano::bufferstream stream{ read_buffer->data () + buffer_begin, HEADER_SIZE };
+			auto error = false;
+			nano::message_header header{ error, stream };
+			if (error)
+			{
+				status = parse_status::invalid_header;
+				callback (boost::asio::error::fault, nullptr);
+				return;
+			}
+			if (!validate (header))
+			{
+				callback (boost::asio::error::fault, nullptr);
+				return;
+			}
+			auto const payload_size = header.payload_length_bytes ();
+			needed = HEADER_SIZE + payload_size;
+			if (available >= needed)
+			{
+				// The payload stays valid until the next read from the stream, which only happens once the callback asks for more
+				auto const payload = read_buffer->data () + buffer_begin + HEADER_SIZE;
+				buffer_begin += needed;
+				if (buffer_begin == buffer_end)
+				{
+					buffer_begin = buffer_end = 0;
+				}
+				delivering = true;
+				received_message (header, payload, payload_size, std::move (callback));
+				delivering = false;
+				continue;
+			}
+		}
+
+		// Not enough room left to complete the message, move the partial message to the front
+		if (buffer_begin + needed > read_buffer->size ())
+		{
+			std::memmove (read_buffer->data (), read_buffer->data () + buffer_begin, available);
+			buffer_begin = 0;
+			buffer_end = available;
+		}
+		debug_assert (buffer_end < read_buffer->size ());
+
+		read_some (read_buffer, buffer_end, read_buffer->size () - buffer_end, [this_l, callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
+			if (ec)
+			{
+				callback (ec, nullptr);
+				return;
+			}
+			this_l->buffer_end += size_a;
+			debug_assert (this_l->buffer_end <= this_l->read_buffer->size ());
+			this_l->pending = std::move (callback);
+			this_l->process_buffered ();
 		});
 	}
 }
 
-void nano::transport::message_deserializer::received_message (nano::message_header header, std::size_t payload_size, const nano::transport::message_deserializer::callback_type && callback)
+void nano::transport::message_deserializer::received_message (nano::message_header header, uint8_t const * payload, std::size_t payload_size, const nano::transport::message_deserializer::callback_type && callback)
 {
-	auto message = deserialize (header, payload_size);
+	if (capture)
+	{
+		capture (header, payload, payload_size);
+	}
+	auto message = deserialize (header, payload, payload_size);
 	if (message)
 	{
 		debug_assert (status == parse_status::none);
@@ -116,10 +209,10 @@ void nano::transport::message_deserializer::received_message (nano::message_head
 	}
 }
 
-std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, std::size_t payload_size)
+std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, uint8_t const * data, std::size_t payload_size)
 {
 	release_assert (payload_size <= MAX_MESSAGE_SIZE);
-	nano::bufferstream stream{ read_buffer->data (), payload_size };
+	nano::bufferstream stream{ data, payload_size };
 	switch (header.type)
 	{
 		case nano::message_type::keepalive:
@@ -130,9 +223,9 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (data, payload_size, &digest))
 			{
-				return deserialize_publish (stream, header, digest);
+				return deserialize_publish (stream, header, digest, data, payload_size);
 			}
 			else
 			{
@@ -148,9 +241,9 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (data, payload_size, &digest))
 			{
-				return deserialize_confirm_ack (stream, header, digest);
+				return deserialize_confirm_ack (stream, header, digest, data, payload_size);
 			}
 			else
 			{
@@ -218,15 +311,20 @@ std::unique_ptr<nano::keepalive> nano::transport::message_deserializer::deserial
 	return {};
 }
 
-std::unique_ptr<nano::publish> nano::transport::message_deserializer::deserialize_publish (nano::stream & stream, nano::message_header const & header, nano::network_filter::digest_t const & digest_a)
+std::unique_ptr<nano::publish> nano::transport::message_deserializer::deserialize_publish (nano::stream & stream, nano::message_header const & header, nano::network_filter::digest_t const & digest_a, uint8_t const * data, std::size_t payload_size)
 {
 	auto error = false;
-	auto incoming = std::make_unique<nano::publish> (error, stream, header, digest_a, &block_uniquer_m);
+	// Uniqued only once it is validated, the block is not shared with other threads before that
+	auto incoming = std::make_unique<nano::publish> (error, stream, header, digest_a);
 	if (!error && nano::at_end (stream))
 	{
 		release_assert (incoming->block);
 		if (!network_constants_m.work.validate_entry (*incoming->block))
 		{
+			// The payload is exactly the serialized block, keep it for relaying. Only copied if no uniqued block exists yet
+			incoming->block = block_uniquer_m.unique (incoming->block, [data, payload_size] (nano::block & block) {
+				block.wire_bytes_set (std::make_shared<std::vector<uint8_t> const> (data, data + payload_size));
+			});
 			return incoming;
 		}
 		else
@@ -256,12 +354,17 @@ std::unique_ptr<nano::confirm_req> nano::transport::message_deserializer::deseri
 	return {};
 }
 
-std::unique_ptr<nano::confirm_ack> nano::transport::message_deserializer::deserialize_confirm_ack (nano::stream & stream, nano::message_header const & header, nano::network_filter::digest_t const & digest_a)
+std::unique_ptr<nano::confirm_ack> nano::transport::message_deserializer::deserialize_confirm_ack (nano::stream & stream, nano::message_header const & header, nano::network_filter::digest_t const & digest_a, uint8_t const * data, std::size_t payload_size)
 {
 	auto error = false;
-	auto incoming = std::make_unique<nano::confirm_ack> (error, stream, header, digest_a, &vote_uniquer_m);
+	// Uniqued only once it is parsed, the vote is not shared with other threads before that
+	auto incoming = std::make_unique<nano::confirm_ack> (error, stream, header, digest_a);
 	if (!error && nano::at_end (stream))
 	{
+		// The payload is exactly the serialized vote, keep it for relaying. Only copied if no uniqued vote exists yet
+		incoming->vote = vote_uniquer_m.unique (incoming->vote, [data, payload_size] (nano::vote & vote) {
+			vote.wire_bytes_set (std::make_shared<std::vector<uint8_t> const> (data, data + payload_size));
+		});
 		return incoming;
 	}
 	else
@@ -5,6 +5,7 @@
 #include <nano/node/messages.hpp>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace nano
@@ -57,19 +58,37 @@ namespace transport
 		 */
 		void read (callback_type const && callback);
 
+		using capture_callback = std::function<void (nano::message_header const &, uint8_t const * payload, std::size_t payload_size)>;
+		/** Called with the raw contents of every message read, before it is deserialized. Used for capturing traffic */
+		capture_callback capture;
+
+		/** Reads at least one and up to `size` bytes into the buffer starting at `offset` */
+		using read_some_query = std::function<void (std::shared_ptr<std::vector<uint8_t>> const &, std::size_t offset, std::size_t size, std::function<void (boost::system::error_code const &, std::size_t)>)>;
+		/**
+		 * If set, reads fill a buffer with as many bytes as are available and every complete message in it is parsed before reading again.
+		 * Messages are deserialized in place, only the incomplete tail is moved to the front of the buffer once it runs out of space.
+		 * Requires that nothing else reads from the underlying stream.
+		 */
+		read_some_query read_some;
+
 	private:
 		void received_header (callback_type const && callback);
-		void received_message (nano::message_header header, std::size_t payload_size, callback_type const && callback);
+		void received_message (nano::message_header header, uint8_t const * payload, std::size_t payload_size, callback_type const && callback);
+		/** Sets `status` and returns false if the header must not be accepted */
+		bool validate (nano::message_header const & header);
+
+		/** Delivers buffered messages while callbacks ask for more, reads from the stream once the buffer has no complete message */
+		void process_buffered ();
 
 		/*
-		 * Deserializes message using data in `read_buffer`.
+		 * Deserializes message using the payload in `data`.
 		 * @return If successful returns non-null message, otherwise sets `status` to error appropriate code and returns nullptr
 		 */
-		std::unique_ptr<nano::message> deserialize (nano::message_header header, std::size_t payload_size);
+		std::unique_ptr<nano::message> deserialize (nano::message_header header, uint8_t const * data, std::size_t payload_size);
 		std::unique_ptr<nano::keepalive> deserialize_keepalive (nano::stream &, nano::message_header const &);
-		std::unique_ptr<nano::publish> deserialize_publish (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest);
+		std::unique_ptr<nano::publish> deserialize_publish (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest, uint8_t const * data, std::size_t payload_size);
 		std::unique_ptr<nano::confirm_req> deserialize_confirm_req (nano::stream &, nano::message_header const &);
-		std::unique_ptr<nano::confirm_ack> deserialize_confirm_ack (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest);
+		std::unique_ptr<nano::confirm_ack> deserialize_confirm_ack (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest, uint8_t const * data, std::size_t payload_size);
 		std::unique_ptr<nano::node_id_handshake> deserialize_node_id_handshake (nano::stream &, nano::message_header const &);
 		std::unique_ptr<nano::telemetry_req> deserialize_telemetry_req (nano::stream &, nano::message_header const &);
 		std::unique_ptr<nano::telemetry_ack> deserialize_telemetry_ack (nano::stream &, nano::message_header const &);
@@ -82,10 +101,19 @@ namespace transport
 
 	private:
 		std::shared_ptr<std::vector<uint8_t>> read_buffer;
+		/** Unparsed bytes of buffered reads are in [buffer_begin, buffer_end) */
+		std::size_t buffer_begin{ 0 };
+		std::size_t buffer_end{ 0 };
+		/** Callback of the read waiting for the next buffered message */
+		std::optional<callback_type> pending;
+		/** Set while a buffered message is being delivered, reads issued from the callback are then served by the outer loop instead of recursing */
+		bool delivering{ false };
 
-	private: // Constants
+	public: // Constants
 		static constexpr std::size_t HEADER_SIZE = 8;
 		static constexpr std::size_t MAX_MESSAGE_SIZE = 1024 * 65;
+		/** Large enough to hold the biggest message */
+		static constexpr std::size_t READ_BUFFER_SIZE = HEADER_SIZE + MAX_MESSAGE_SIZE;
 
 	private: // Dependencies
 		nano::network_constants const & network_constants_m;
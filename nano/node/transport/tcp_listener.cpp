@@ -276,10 +276,12 @@ auto nano::transport::tcp_listener::connect_impl (asio::ip::tcp::endpoint endpoi
 
 	try
 	{
-		auto raw_socket = co_await connect_socket (endpoint);
+		// The socket is bound to this io_context for its whole lifetime
+		auto & io_ctx = node.connection_io_ctx ();
+		auto raw_socket = co_await connect_socket (endpoint, io_ctx);
 		debug_assert (strand.running_in_this_thread ());
 
-		auto result = accept_one (std::move (raw_socket), connection_type::outbound);
+		auto result = accept_one (std::move (raw_socket), io_ctx, connection_type::outbound);
 		if (result.result == accept_result::accepted)
 		{
 			stats.inc (nano::stat::type::tcp_listener, nano::stat::detail::connect_success, nano::stat::dir::out);
@@ -311,10 +313,12 @@ asio::awaitable<void> nano::transport::tcp_listener::run ()
 
 		try
 		{
-			auto socket = co_await accept_socket ();
+			// The socket is bound to this io_context for its whole lifetime
+			auto & io_ctx = node.connection_io_ctx ();
+			auto socket = co_await accept_socket (io_ctx);
 			debug_assert (strand.running_in_this_thread ());
 
-			auto result = accept_one (std::move (socket), connection_type::inbound);
+			auto result = accept_one (std::move (socket), io_ctx, connection_type::inbound);
 			if (result.result != accept_result::accepted)
 			{
 				stats.inc (nano::stat::type::tcp_listener, nano::stat::detail::accept_failure, nano::stat::dir::in);
@@ -337,18 +341,18 @@ asio::awaitable<void> nano::transport::tcp_listener::run ()
 	}
 }
 
-asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::accept_socket ()
+asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::accept_socket (asio::io_context & io_ctx)
 {
 	debug_assert (strand.running_in_this_thread ());
 
-	co_return co_await acceptor.async_accept (asio::use_awaitable);
+	co_return co_await acceptor.async_accept (asio::any_io_executor{ io_ctx.get_executor () }, asio::use_awaitable);
 }
 
-asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::connect_socket (asio::ip::tcp::endpoint endpoint)
+asio::awaitable<asio::ip::tcp::socket> nano::transport::tcp_listener::connect_socket (asio::ip::tcp::endpoint endpoint, asio::io_context & io_ctx)
 {
 	debug_assert (strand.running_in_this_thread ());
 
-	asio::ip::tcp::socket raw_socket{ strand };
+	asio::ip::tcp::socket raw_socket{ io_ctx };
 	co_await raw_socket.async_connect (endpoint, asio::use_awaitable);
 
 	co_return raw_socket;
@@ -369,7 +373,7 @@ asio::awaitable<void> nano::transport::tcp_listener::wait_available_slots () con
 	}
 }
 
-auto nano::transport::tcp_listener::accept_one (asio::ip::tcp::socket raw_socket, connection_type type) -> accept_return
+auto nano::transport::tcp_listener::accept_one (asio::ip::tcp::socket raw_socket, asio::io_context & io_ctx, connection_type type) -> accept_return
 {
 	auto const remote_endpoint = raw_socket.remote_endpoint ();
 	auto const local_endpoint = raw_socket.local_endpoint ();
@@ -405,7 +409,7 @@ auto nano::transport::tcp_listener::accept_one (asio::ip::tcp::socket raw_socket
 	stats.inc (nano::stat::type::tcp_listener, nano::stat::detail::accept_success, to_stat_dir (type));
 	logger.debug (nano::log::type::tcp_listener, "Accepted connection: {} ({})", fmt::streamed (remote_endpoint), to_string (type));
 
-	auto socket = std::make_shared<nano::transport::tcp_socket> (node, std::move (raw_socket), remote_endpoint, local_endpoint, to_socket_endpoint (type));
+	auto socket = std::make_shared<nano::transport::tcp_socket> (node, io_ctx, std::move (raw_socket), remote_endpoint, local_endpoint, to_socket_endpoint (type));
 	auto server = std::make_shared<nano::transport::tcp_server> (socket, node.shared (), true);
 
 	connections.emplace_back (connection{ remote_endpoint, socket, server });
@@ -111,7 +111,7 @@ private:
 	};
 
 	asio::awaitable<void> connect_impl (asio::ip::tcp::endpoint);
-	asio::awaitable<asio::ip::tcp::socket> connect_socket (asio::ip::tcp::endpoint);
+	asio::awaitable<asio::ip::tcp::socket> connect_socket (asio::ip::tcp::endpoint, asio::io_context &);
 
 	struct accept_return
 	{
@@ -120,9 +120,9 @@ private:
 		std::shared_ptr<nano::transport::tcp_server> server;
 	};
 
-	accept_return accept_one (asio::ip::tcp::socket, connection_type);
+	accept_return accept_one (asio::ip::tcp::socket, asio::io_context &, connection_type);
 	accept_result check_limits (asio::ip::address const & ip, connection_type);
-	asio::awaitable<asio::ip::tcp::socket> accept_socket ();
+	asio::awaitable<asio::ip::tcp::socket> accept_socket (asio::io_context &);
 
 	size_t count_per_type (connection_type) const;
 	size_t count_per_ip (asio::ip::address const & ip) const;
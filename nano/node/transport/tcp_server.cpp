@@ -3,6 +3,7 @@
 #include <nano/node/transport/message_deserializer.hpp>
 #include <nano/node/transport/tcp_listener.hpp>
 #include <nano/node/transport/tcp_server.hpp>
+#include <nano/node/transport/traffic_capture.hpp>
 
 #include <memory>
 
@@ -23,6 +24,16 @@ nano::transport::tcp_server::tcp_server (std::shared_ptr<nano::transport::tcp_so
 	}
 {
 	debug_assert (socket != nullptr);
+	// Messages are only ever read through the deserializer, so it can read ahead and parse several messages per read
+	message_deserializer->read_some = [socket_l = socket] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
+		socket_l->read_some_impl (data_a, offset_a, size_a, callback_a);
+	};
+	if (auto recorder = node_a->traffic_recorder)
+	{
+		message_deserializer->capture = [recorder, channel_id = recorder->channel_id_next ()] (nano::message_header const & header, uint8_t const * payload, std::size_t payload_size) {
+			recorder->record (channel_id, header, payload, payload_size);
+		};
+	}
 }
 
 nano::transport::tcp_server::~tcp_server ()
@@ -19,14 +19,20 @@
  */
 
 nano::transport::tcp_socket::tcp_socket (nano::node & node_a, nano::transport::socket_endpoint endpoint_type_a, std::size_t max_queue_size_a) :
-	tcp_socket{ node_a, boost::asio::ip::tcp::socket{ node_a.io_ctx }, {}, {}, endpoint_type_a, max_queue_size_a }
+	tcp_socket{ node_a, node_a.connection_io_ctx (), endpoint_type_a, max_queue_size_a }
 {
 }
 
-nano::transport::tcp_socket::tcp_socket (nano::node & node_a, boost::asio::ip::tcp::socket raw_socket_a, boost::asio::ip::tcp::endpoint remote_endpoint_a, boost::asio::ip::tcp::endpoint local_endpoint_a, nano::transport::socket_endpoint endpoint_type_a, std::size_t max_queue_size_a) :
+nano::transport::tcp_socket::tcp_socket (nano::node & node_a, boost::asio::io_context & io_ctx_a, nano::transport::socket_endpoint endpoint_type_a, std::size_t max_queue_size_a) :
+	tcp_socket{ node_a, io_ctx_a, boost::asio::ip::tcp::socket{ io_ctx_a }, {}, {}, endpoint_type_a, max_queue_size_a }
+{
+}
+
+nano::transport::tcp_socket::tcp_socket (nano::node & node_a, boost::asio::io_context & io_ctx_a, boost::asio::ip::tcp::socket raw_socket_a, boost::asio::ip::tcp::endpoint remote_endpoint_a, boost::asio::ip::tcp::endpoint local_endpoint_a, nano::transport::socket_endpoint endpoint_type_a, std::size_t max_queue_size_a) :
 	send_queue{ max_queue_size_a },
 	node_w{ node_a.shared () },
-	strand{ node_a.io_ctx.get_executor () },
+	// Handlers run on the io_context the socket is bound to, which is not necessarily the node's shared one
+	strand{ io_ctx_a.get_executor () },
 	raw_socket{ std::move (raw_socket_a) },
 	remote{ remote_endpoint_a },
 	local{ local_endpoint_a },
@@ -38,6 +44,7 @@ nano::transport::tcp_socket::tcp_socket (nano::node & node_a, boost::asio::ip::t
 	silent_connection_tolerance_time{ node_a.network_params.network.silent_connection_tolerance_time },
 	max_queue_size{ max_queue_size_a }
 {
+	debug_assert (&raw_socket.get_executor ().context () == &static_cast<boost::asio::execution_context &> (io_ctx_a));
 }
 
 nano::transport::tcp_socket::~tcp_socket ()
@@ -98,36 +105,10 @@ void nano::transport::tcp_socket::async_read (std::shared_ptr<std::vector<uint8_
 
 	if (size_a <= buffer_a->size ())
 	{
-		if (!closed)
-		{
-			set_default_timeout ();
-			boost::asio::post (strand, [this_l = shared_from_this (), buffer_a, callback = std::move (callback_a), size_a] () mutable {
-				boost::asio::async_read (this_l->raw_socket, boost::asio::buffer (buffer_a->data (), size_a),
-				boost::asio::bind_executor (this_l->strand,
-				[this_l, buffer_a, cbk = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
-					debug_assert (this_l->strand.running_in_this_thread ());
-
-					auto node_l = this_l->node_w.lock ();
-					if (!node_l)
-					{
-						return;
-					}
-
-					if (ec)
-					{
-						node_l->stats.inc (nano::stat::type::tcp, nano::stat::detail::tcp_read_error, nano::stat::dir::in);
-						this_l->close ();
-					}
-					else
-					{
-						node_l->stats.add (nano::stat::type::traffic_tcp, nano::stat::detail::all, nano::stat::dir::in, size_a);
-						this_l->set_last_completion ();
-						this_l->set_last_receive_time ();
-					}
-					cbk (ec, size_a);
-				}));
-			});
-		}
+		read (buffer_a, [buffer_a, size_a] (auto & socket, auto handler) {
+			boost::asio::async_read (socket, boost::asio::buffer (buffer_a->data (), size_a), std::move (handler));
+		},
+		std::move (callback_a));
 	}
 	else
 	{
@@ -137,6 +118,62 @@ void nano::transport::tcp_socket::async_read (std::shared_ptr<std::vector<uint8_
 	}
 }
 
+void nano::transport::tcp_socket::async_read_some (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, std::size_t offset_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	debug_assert (callback_a);
+
+	if (offset_a + size_a <= buffer_a->size () && size_a > 0)
+	{
+		read (buffer_a, [buffer_a, offset_a, size_a] (auto & socket, auto handler) {
+			socket.async_read_some (boost::asio::buffer (buffer_a->data () + offset_a, size_a), std::move (handler));
+		},
+		std::move (callback_a));
+	}
+	else
+	{
+		debug_assert (false && "nano::transport::tcp_socket::async_read_some called with incorrect buffer size");
+		boost::system::error_code ec_buffer = boost::system::errc::make_error_code (boost::system::errc::no_buffer_space);
+		callback_a (ec_buffer, 0);
+	}
+}
+
+template <typename Operation>
+void nano::transport::tcp_socket::read (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, Operation operation_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	if (closed)
+	{
+		return;
+	}
+
+	set_default_timeout ();
+	boost::asio::post (strand, [this_l = shared_from_this (), buffer_a, operation = std::move (operation_a), callback = std::move (callback_a)] () mutable {
+		operation (this_l->raw_socket,
+		boost::asio::bind_executor (this_l->strand,
+		[this_l, buffer_a, cbk = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
+			debug_assert (this_l->strand.running_in_this_thread ());
+
+			auto node_l = this_l->node_w.lock ();
+			if (!node_l)
+			{
+				return;
+			}
+
+			if (ec)
+			{
+				node_l->stats.inc (nano::stat::type::tcp, nano::stat::detail::tcp_read_error, nano::stat::dir::in);
+				this_l->close ();
+			}
+			else
+			{
+				node_l->stats.add (nano::stat::type::traffic_tcp, nano::stat::detail::all, nano::stat::dir::in, size_a);
+				this_l->set_last_completion ();
+				this_l->set_last_receive_time ();
+			}
+			cbk (ec, size_a);
+		}));
+	});
+}
+
 void nano::transport::tcp_socket::async_write (nano::shared_const_buffer const & buffer_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a, nano::transport::traffic_type traffic_type)
 {
 	auto node_l = node_w.lock ();
@@ -186,17 +223,25 @@ void nano::transport::tcp_socket::write_queued_messages ()
 		return;
 	}
 
-	auto next = send_queue.pop ();
-	if (!next)
+	// Gather queued messages into a single write to save a syscall and a completion handler per message
+	auto batch = send_queue.pop (max_write_batch, max_write_batch_bytes);
+	if (batch.empty ())
 	{
 		return;
 	}
 
+	std::vector<boost::asio::const_buffer> buffers;
+	buffers.reserve (batch.size ());
+	for (auto const & entry : batch)
+	{
+		buffers.insert (buffers.end (), entry.buffer.begin (), entry.buffer.end ());
+	}
+
 	set_default_timeout ();
 
 	write_in_progress = true;
-	nano::async_write (raw_socket, next->buffer,
-	boost::asio::bind_executor (strand, [this_l = shared_from_this (), next /* `next` object keeps buffer in scope */] (boost::system::error_code ec, std::size_t size) {
+	nano::unsafe_async_write (raw_socket, buffers,
+	boost::asio::bind_executor (strand, [this_l = shared_from_this (), batch = std::move (batch) /* `batch` keeps buffers in scope */] (boost::system::error_code ec, std::size_t size) {
 		debug_assert (this_l->strand.running_in_this_thread ());
 
 		auto node_l = this_l->node_w.lock ();
@@ -217,9 +262,16 @@ void nano::transport::tcp_socket::write_queued_messages ()
 			this_l->set_last_completion ();
 		}
 
-		if (next->callback)
+		// Buffers are written in order, on error each callback receives the part of its own buffer that made it out
+		auto remaining = size;
+		for (auto const & entry : batch)
 		{
-			next->callback (ec, size);
+			auto const written = std::min (remaining, entry.buffer.size ());
+			remaining -= written;
+			if (entry.callback)
+			{
+				entry.callback (ec, written);
+			}
 		}
 
 		if (!ec)
@@ -328,6 +380,23 @@ void nano::transport::tcp_socket::ongoing_checkup ()
 }
 
 void nano::transport::tcp_socket::read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	read_idle ([this, &data_a, size_a] (auto callback) {
+		async_read (data_a, size_a, std::move (callback));
+	},
+	std::move (callback_a));
+}
+
+void nano::transport::tcp_socket::read_some_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
+{
+	read_idle ([this, &data_a, offset_a, size_a] (auto callback) {
+		async_read_some (data_a, offset_a, size_a, std::move (callback));
+	},
+	std::move (callback_a));
+}
+
+template <typename Read>
+void nano::transport::tcp_socket::read_idle (Read const & read_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a)
 {
 	auto node_l = node_w.lock ();
 	if (!node_l)
@@ -338,7 +407,7 @@ void nano::transport::tcp_socket::read_impl (std::shared_ptr<std::vector<uint8_t
 	// Increase timeout to receive TCP header (idle server socket)
 	auto const prev_timeout = get_default_timeout_value ();
 	set_default_timeout_value (node_l->network_params.network.idle_timeout);
-	async_read (data_a, size_a, [callback_l = std::move (callback_a), prev_timeout, this_l = shared_from_this ()] (boost::system::error_code const & ec_a, std::size_t size_a) {
+	read_a ([callback_l = std::move (callback_a), prev_timeout, this_l = shared_from_this ()] (boost::system::error_code const & ec_a, std::size_t size_a) {
 		this_l->set_default_timeout_value (prev_timeout);
 		callback_l (ec_a, size_a);
 	});
@@ -408,6 +477,11 @@ nano::tcp_endpoint nano::transport::tcp_socket::local_endpoint () const
 	return local;
 }
 
+boost::asio::io_context & nano::transport::tcp_socket::context () const
+{
+	return strand.get_inner_executor ().context ();
+}
+
 void nano::transport::tcp_socket::operator() (nano::object_stream & obs) const
 {
 	obs.write ("remote_endpoint", remote_endpoint ());
@@ -436,32 +510,36 @@ bool nano::transport::socket_queue::insert (const buffer_t & buffer, callback_t
 	return false; // Not queued
 }
 
-std::optional<nano::transport::socket_queue::entry> nano::transport::socket_queue::pop ()
+auto nano::transport::socket_queue::pop (std::size_t max_count, std::size_t max_bytes) -> std::vector<entry>
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
 
-	auto try_pop = [this] (nano::transport::traffic_type type) -> std::optional<entry> {
+	std::vector<entry> result;
+	std::size_t bytes = 0;
+	auto try_pop = [&, this] (nano::transport::traffic_type type) {
 		auto & que = queues[type];
-		if (!que.empty ())
+		while (!que.empty () && result.size () < max_count)
 		{
-			auto item = que.front ();
+			auto const size = que.front ().buffer.size ();
+			if (!result.empty () && bytes + size > max_bytes)
+			{
+				return false; // Batch full
+			}
+			bytes += size;
+			result.push_back (std::move (que.front ()));
 			que.pop ();
-			return item;
 		}
-		return std::nullopt;
+		return result.size () < max_count;
 	};
 
+	// Lower priority traffic is only taken once higher priority queues are drained, preserving the order between traffic types
 	// TODO: This is a very basic prioritization, implement something more advanced and configurable
-	if (auto item = try_pop (nano::transport::traffic_type::generic))
-	{
-		return item;
-	}
-	if (auto item = try_pop (nano::transport::traffic_type::bootstrap))
+	if (try_pop (nano::transport::traffic_type::generic))
 	{
-		return item;
+		try_pop (nano::transport::traffic_type::bootstrap);
 	}
 
-	return std::nullopt;
+	return result;
 }
 
 void nano::transport::socket_queue::clear ()
@@ -45,7 +45,11 @@ public:
 	explicit socket_queue (std::size_t max_size);
 
 	bool insert (buffer_t const &, callback_t, nano::transport::traffic_type);
-	std::optional<entry> pop ();
+	/**
+	 * Pops queued entries in priority order, up to `max_count` entries and `max_bytes` bytes
+	 * The first entry is always returned even if it is larger than `max_bytes`
+	 */
+	std::vector<entry> pop (std::size_t max_count, std::size_t max_bytes);
 	void clear ();
 	std::size_t size (nano::transport::traffic_type) const;
 	bool empty () const;
@@ -66,13 +70,18 @@ class tcp_socket final : public std::enable_shared_from_this<tcp_socket>
 
 public:
 	static std::size_t constexpr default_max_queue_size = 128;
+	/** Limits of the number of queued messages and bytes gathered into a single socket write */
+	static std::size_t constexpr max_write_batch = 64;
+	static std::size_t constexpr max_write_batch_bytes = 64 * 1024;
 
 public:
 	explicit tcp_socket (nano::node &, nano::transport::socket_endpoint = socket_endpoint::client, std::size_t max_queue_size = default_max_queue_size);
 
 	// TODO: Accepting remote/local endpoints as a parameter is unnecessary, but is needed for now to keep compatibility with the legacy code
+	// The raw socket must be bound to the passed io_context, the socket's handlers run on it
 	tcp_socket (
 	nano::node &,
+	boost::asio::io_context &,
 	boost::asio::ip::tcp::socket,
 	boost::asio::ip::tcp::endpoint remote_endpoint,
 	boost::asio::ip::tcp::endpoint local_endpoint,
@@ -93,6 +102,13 @@ public:
 	std::size_t size,
 	std::function<void (boost::system::error_code const &, std::size_t)> callback);
 
+	/** Reads whatever is available, at least one and up to `size` bytes, into the buffer starting at `offset` */
+	void async_read_some (
+	std::shared_ptr<std::vector<uint8_t>> const & buffer,
+	std::size_t offset,
+	std::size_t size,
+	std::function<void (boost::system::error_code const &, std::size_t)> callback);
+
 	void async_write (
 	nano::shared_const_buffer const &,
 	std::function<void (boost::system::error_code const &, std::size_t)> callback = {},
@@ -100,6 +116,8 @@ public:
 
 	boost::asio::ip::tcp::endpoint remote_endpoint () const;
 	boost::asio::ip::tcp::endpoint local_endpoint () const;
+	/** Context the socket's handlers run on */
+	boost::asio::io_context & context () const;
 
 	/** Returns true if the socket has timed out */
 	bool has_timed_out () const;
@@ -141,6 +159,8 @@ public:
 	}
 
 private:
+	tcp_socket (nano::node &, boost::asio::io_context &, nano::transport::socket_endpoint, std::size_t max_queue_size);
+
 	socket_queue send_queue;
 
 protected:
@@ -193,6 +213,13 @@ protected:
 	void set_last_receive_time ();
 	void ongoing_checkup ();
 	void read_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
+	void read_some_impl (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t offset_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
+	/** Starts `operation` on the strand with a completion handler that records traffic and closes the socket on error */
+	template <typename Operation>
+	void read (std::shared_ptr<std::vector<uint8_t>> const & buffer_a, Operation operation_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
+	/** Runs `read` with the idle timeout, restoring the default one once it completes */
+	template <typename Read>
+	void read_idle (Read const & read_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a);
 
 private:
 	socket_endpoint const endpoint_type_m;
@@ -0,0 +1,141 @@
+#include <nano/lib/stream.hpp>
+#include <nano/node/messages.hpp>
+#include <nano/node/transport/message_deserializer.hpp>
+#include <nano/node/transport/traffic_capture.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+std::array<char, 4> constexpr capture_magic{ 'N', 'T', 'C', 'P' };
+uint8_t constexpr capture_version = 1;
+// Timestamp, channel id, message size
+std::size_t constexpr record_header_size = sizeof (uint64_t) + sizeof (uint64_t) + sizeof (uint32_t);
+}
+
+/*
+ * traffic_recorder
+ */
+
+nano::transport::traffic_recorder::traffic_recorder (std::filesystem::path const & path_a, nano::network_constants const & network_constants_a) :
+	file{ path_a, std::ios::binary | std::ios::trunc },
+	start{ std::chrono::steady_clock::now () }
+{
+	if (file)
+	{
+		auto const network = static_cast<uint16_t> (network_constants_a.current_network);
+		file.write (capture_magic.data (), capture_magic.size ());
+		file.write (reinterpret_cast<char const *> (&capture_version), sizeof (capture_version));
+		file.write (reinterpret_cast<char const *> (&network), sizeof (network));
+	}
+}
+
+nano::transport::traffic_recorder::~traffic_recorder ()
+{
+	flush ();
+}
+
+bool nano::transport::traffic_recorder::init_error () const
+{
+	return !file;
+}
+
+uint64_t nano::transport::traffic_recorder::channel_id_next ()
+{
+	return next_channel_id++;
+}
+
+void nano::transport::traffic_recorder::record (uint64_t channel_id, nano::message_header const & header, uint8_t const * payload, std::size_t payload_size)
+{
+	auto const timestamp = static_cast<uint64_t> (std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start).count ());
+
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	buffer.clear ();
+	{
+		nano::vectorstream stream{ buffer };
+		nano::write (stream, timestamp);
+		nano::write (stream, channel_id);
+		nano::write (stream, static_cast<uint32_t> (nano::message_header::size + payload_size));
+		header.serialize (stream);
+	}
+	debug_assert (buffer.size () == record_header_size + nano::message_header::size);
+	file.write (reinterpret_cast<char const *> (buffer.data ()), buffer.size ());
+	file.write (reinterpret_cast<char const *> (payload), payload_size);
+	++recorded_count;
+}
+
+void nano::transport::traffic_recorder::flush ()
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	file.flush ();
+}
+
+uint64_t nano::transport::traffic_recorder::recorded () const
+{
+	return recorded_count;
+}
+
+/*
+ * traffic_reader
+ */
+
+nano::transport::traffic_reader::traffic_reader (std::filesystem::path const & path_a) :
+	file{ path_a, std::ios::binary }
+{
+	std::array<char, 4> magic{};
+	uint8_t version{ 0 };
+	uint16_t network{ 0 };
+	file.read (magic.data (), magic.size ());
+	file.read (reinterpret_cast<char *> (&version), sizeof (version));
+	file.read (reinterpret_cast<char *> (&network), sizeof (network));
+	error = !file || magic != capture_magic || version != capture_version;
+	if (!error)
+	{
+		network_m = static_cast<nano::networks> (network);
+	}
+}
+
+bool nano::transport::traffic_reader::init_error () const
+{
+	return error;
+}
+
+nano::networks nano::transport::traffic_reader::network () const
+{
+	return network_m;
+}
+
+std::optional<nano::transport::traffic_reader::record> nano::transport::traffic_reader::next ()
+{
+	if (error)
+	{
+		return std::nullopt;
+	}
+	std::array<uint8_t, record_header_size> header{};
+	if (!file.read (reinterpret_cast<char *> (header.data ()), header.size ()))
+	{
+		return std::nullopt;
+	}
+	uint64_t timestamp{ 0 };
+	uint64_t channel_id{ 0 };
+	uint32_t size{ 0 };
+	std::memcpy (&timestamp, header.data (), sizeof (timestamp));
+	std::memcpy (&channel_id, header.data () + sizeof (timestamp), sizeof (channel_id));
+	std::memcpy (&size, header.data () + sizeof (timestamp) + sizeof (channel_id), sizeof (size));
+	if (size > nano::message_header::size + nano::transport::message_deserializer::MAX_MESSAGE_SIZE)
+	{
+		// No message can be this large, the file is corrupt
+		error = true;
+		return std::nullopt;
+	}
+
+	record result{ std::chrono::microseconds{ timestamp }, channel_id, std::vector<uint8_t> (size) };
+	if (!file.read (reinterpret_cast<char *> (result.data.data ()), size))
+	{
+		// Truncated record, the capturing node was most likely killed while writing
+		error = true;
+		return std::nullopt;
+	}
+	return result;
+}
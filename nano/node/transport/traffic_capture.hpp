@@ -0,0 +1,83 @@
+#pragma once
+
+#include <nano/lib/config.hpp>
+#include <nano/lib/locks.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+namespace nano
+{
+class message_header;
+}
+
+/*
+ * Capture file layout, integers in host byte order:
+ *   header: 4 byte magic, 1 byte format version, 2 byte network id
+ *   records: 8 byte timestamp (microseconds since capture start), 8 byte channel id, 4 byte message size, message header and payload
+ */
+namespace nano::transport
+{
+/**
+ * Records the raw inbound message stream of all realtime and bootstrap connections, for offline replay with `--debug_replay_traffic`
+ */
+class traffic_recorder final
+{
+public:
+	traffic_recorder (std::filesystem::path const &, nano::network_constants const &);
+	~traffic_recorder ();
+
+	/** Returns true if the capture file could not be created */
+	bool init_error () const;
+
+	/** Unique id identifying the connection messages were received on */
+	uint64_t channel_id_next ();
+	void record (uint64_t channel_id, nano::message_header const &, uint8_t const * payload, std::size_t payload_size);
+	void flush ();
+
+	uint64_t recorded () const;
+
+private:
+	std::ofstream file;
+	std::chrono::steady_clock::time_point const start;
+	std::atomic<uint64_t> next_channel_id{ 1 };
+	std::atomic<uint64_t> recorded_count{ 0 };
+	std::vector<uint8_t> buffer;
+	nano::mutex mutex;
+};
+
+/**
+ * Reads records of a file written by traffic_recorder in order
+ */
+class traffic_reader final
+{
+public:
+	class record final
+	{
+	public:
+		std::chrono::microseconds timestamp;
+		uint64_t channel_id;
+		/** Message header followed by the payload */
+		std::vector<uint8_t> data;
+	};
+
+	explicit traffic_reader (std::filesystem::path const &);
+
+	/** Returns true if the file could not be opened or is not a capture file */
+	bool init_error () const;
+	nano::networks network () const;
+
+	/** Returns the next record or nullopt once the end of the file or a malformed record is reached */
+	std::optional<record> next ();
+
+private:
+	std::ifstream file;
+	nano::networks network_m{ nano::networks::invalid };
+	bool error{ false };
+};
+}
@@ -6,8 +6,9 @@
 #include <nano/lib/timer.hpp>
 #include <nano/node/unchecked_map.hpp>
 
-nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::stats & stats, bool const & disable_delete) :
+nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::stats & stats, bool const & disable_delete, std::size_t max_unchecked_memory) :
 	max_unchecked_blocks{ max_unchecked_blocks },
+	max_unchecked_memory{ max_unchecked_memory },
 	stats{ stats },
 	disable_delete{ disable_delete }
 {
@@ -15,17 +16,20 @@ nano::unchecked_map::unchecked_map (unsigned const max_unchecked_blocks, nano::s
 
 nano::unchecked_map::~unchecked_map ()
 {
-	debug_assert (!thread.joinable ());
+	debug_assert (threads.empty ());
 }
 
 void nano::unchecked_map::start ()
 {
-	debug_assert (!thread.joinable ());
+	debug_assert (threads.empty ());
 
-	thread = std::thread ([this] () {
-		nano::thread_role::set (nano::thread_role::name::unchecked);
-		run ();
-	});
+	for (unsigned i = 0; i < thread_count; ++i)
+	{
+		threads.emplace_back ([this] () {
+			nano::thread_role::set (nano::thread_role::name::unchecked);
+			run ();
+		});
+	}
 }
 
 void nano::unchecked_map::stop ()
@@ -36,39 +40,85 @@ void nano::unchecked_map::stop ()
 	}
 	condition.notify_all ();
 
-	if (thread.joinable ())
+	for (auto & thread : threads)
 	{
 		thread.join ();
 	}
+	threads.clear ();
 }
 
 void nano::unchecked_map::put (nano::hash_or_account const & dependency, nano::unchecked_info const & info)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
 	nano::unchecked_key key{ dependency, info.block->hash () };
-	entries.get<tag_root> ().insert ({ key, info });
-
-	if (entries.size () > max_unchecked_blocks)
+	auto const size = entry_size (info);
+	auto & shard = shard_for (key.key ());
 	{
-		entries.get<tag_sequenced> ().pop_front ();
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		auto [existing, inserted] = shard.entries.get<tag_root> ().insert ({ key, info, std::chrono::steady_clock::now (), size });
+		if (inserted)
+		{
+			++entries_count;
+			memory_m += size;
+		}
 	}
 
 	stats.inc (nano::stat::type::unchecked, nano::stat::detail::put);
+
+	evict ();
+}
+
+void nano::unchecked_map::evict ()
+{
+	while (entries_count > max_unchecked_blocks || memory_m > max_unchecked_memory)
+	{
+		// Shards are locked one at a time, the oldest entry might be gone by the time its shard is locked again which only costs another round
+		shard * oldest = nullptr;
+		auto oldest_arrival = std::chrono::steady_clock::time_point::max ();
+		for (auto & shard : shards)
+		{
+			nano::lock_guard<nano::mutex> lock{ shard.mutex };
+			if (!shard.entries.empty () && shard.entries.front ().arrival < oldest_arrival)
+			{
+				oldest = &shard;
+				oldest_arrival = shard.entries.front ().arrival;
+			}
+		}
+		if (oldest == nullptr)
+		{
+			break;
+		}
+		nano::lock_guard<nano::mutex> lock{ oldest->mutex };
+		if (!oldest->entries.empty ())
+		{
+			--entries_count;
+			memory_m -= oldest->entries.front ().size;
+			oldest->entries.get<tag_sequenced> ().pop_front ();
+			stats.inc (nano::stat::type::unchecked, nano::stat::detail::evicted);
+		}
+	}
 }
 
 void nano::unchecked_map::for_each (std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.begin (), n = entries.end (); predicate () && i != n; ++i)
+	for (auto & shard : shards)
 	{
-		action (i->key, i->info);
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		for (auto i = shard.entries.begin (), n = shard.entries.end (); i != n; ++i)
+		{
+			if (!predicate ())
+			{
+				return;
+			}
+			action (i->key, i->info);
+		}
 	}
 }
 
 void nano::unchecked_map::for_each (nano::hash_or_account const & dependency, std::function<void (nano::unchecked_key const &, nano::unchecked_info const &)> action, std::function<bool ()> predicate)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	for (auto i = entries.template get<tag_root> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = entries.template get<tag_root> ().end (); predicate () && i != n && i->key.key () == dependency.as_block_hash (); ++i)
+	auto & shard = shard_for (dependency.as_block_hash ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	for (auto i = shard.entries.template get<tag_root> ().lower_bound (nano::unchecked_key{ dependency, 0 }), n = shard.entries.template get<tag_root> ().end (); predicate () && i != n && i->key.key () == dependency.as_block_hash (); ++i)
 	{
 		action (i->key, i->info);
 	}
@@ -85,27 +135,43 @@ std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::block_hash con
 
 bool nano::unchecked_map::exists (nano::unchecked_key const & key) const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.get<tag_root> ().count (key) != 0;
+	auto const & shard = shard_for (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	return shard.entries.get<tag_root> ().count (key) != 0;
 }
 
 void nano::unchecked_map::del (nano::unchecked_key const & key)
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	auto erased = entries.get<tag_root> ().erase (key);
-	debug_assert (erased);
+	auto & shard = shard_for (key.key ());
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto & entries_by_root = shard.entries.get<tag_root> ();
+	auto existing = entries_by_root.find (key);
+	debug_assert (existing != entries_by_root.end ());
+	if (existing != entries_by_root.end ())
+	{
+		--entries_count;
+		memory_m -= existing->size;
+		entries_by_root.erase (existing);
+	}
 }
 
 void nano::unchecked_map::clear ()
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	entries.clear ();
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		for (auto const & entry : shard.entries)
+		{
+			--entries_count;
+			memory_m -= entry.size;
+		}
+		shard.entries.clear ();
+	}
 }
 
 size_t nano::unchecked_map::entries_size () const
 {
-	nano::lock_guard<std::recursive_mutex> lock{ entries_mutex };
-	return entries.size ();
+	return entries_count;
 }
 
 size_t nano::unchecked_map::queries_size () const
@@ -119,21 +185,18 @@ size_t nano::unchecked_map::count () const
 	return entries_size ();
 }
 
+size_t nano::unchecked_map::memory () const
+{
+	return memory_m;
+}
+
 void nano::unchecked_map::trigger (nano::hash_or_account const & dependency)
 {
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	buffer.emplace_back (dependency);
 	lock.unlock ();
 	stats.inc (nano::stat::type::unchecked, nano::stat::detail::trigger);
-	condition.notify_all (); // Notify run ()
-}
-
-void nano::unchecked_map::process_queries (decltype (buffer) const & back_buffer)
-{
-	for (auto const & item : back_buffer)
-	{
-		query_impl (item.hash);
-	}
+	condition.notify_one (); // Notify run ()
 }
 
 void nano::unchecked_map::run ()
@@ -143,13 +206,20 @@ void nano::unchecked_map::run ()
 	{
 		if (!buffer.empty ())
 		{
-			back_buffer.swap (buffer);
-			writing_back_buffer = true;
+			// Threads take bounded batches so a burst of triggers is spread over all of them
+			auto const batch_end = buffer.begin () + std::min (buffer.size (), query_batch_size);
+			std::deque<nano::hash_or_account> batch{ buffer.begin (), batch_end };
+			buffer.erase (buffer.begin (), batch_end);
+			if (!buffer.empty ())
+			{
+				condition.notify_one ();
+			}
 			lock.unlock ();
-			process_queries (back_buffer);
+			for (auto const & item : batch)
+			{
+				query_impl (item.hash);
+			}
 			lock.lock ();
-			writing_back_buffer = false;
-			back_buffer.clear ();
 		}
 		else
 		{
@@ -162,19 +232,48 @@ void nano::unchecked_map::run ()
 
 void nano::unchecked_map::query_impl (nano::block_hash const & hash)
 {
-	std::deque<nano::unchecked_key> delete_queue;
-	for_each (hash, [this, &delete_queue] (nano::unchecked_key const & key, nano::unchecked_info const & info) {
-		delete_queue.push_back (key);
-		stats.inc (nano::stat::type::unchecked, nano::stat::detail::satisfied);
-		satisfied.notify (info);
-	});
-	if (!disable_delete)
+	// Entries are collected under the shard lock, observers are notified after releasing it
+	std::vector<nano::unchecked_info> satisfied_l;
 	{
-		for (auto const & key : delete_queue)
+		auto & shard = shard_for (hash);
+		nano::lock_guard<nano::mutex> lock{ shard.mutex };
+		auto & entries_by_root = shard.entries.get<tag_root> ();
+		for (auto i = entries_by_root.lower_bound (nano::unchecked_key{ hash, 0 }), n = entries_by_root.end (); i != n && i->key.key () == hash;)
 		{
-			del (key);
+			satisfied_l.push_back (i->info);
+			if (!disable_delete)
+			{
+				--entries_count;
+				memory_m -= i->size;
+				i = entries_by_root.erase (i);
+			}
+			else
+			{
+				++i;
+			}
 		}
 	}
+	for (auto const & info : satisfied_l)
+	{
+		stats.inc (nano::stat::type::unchecked, nano::stat::detail::satisfied);
+		satisfied.notify (info);
+	}
+}
+
+std::size_t nano::unchecked_map::entry_size (nano::unchecked_info const & info)
+{
+	// Serialized block size approximates the in-memory block, plus shared_ptr control block and container node overhead
+	return nano::block::size (info.block->type ()) + sizeof (entry) + 96;
+}
+
+auto nano::unchecked_map::shard_for (nano::block_hash const & dependency) -> shard &
+{
+	return shards[dependency.qwords[0] % shards.size ()];
+}
+
+auto nano::unchecked_map::shard_for (nano::block_hash const & dependency) const -> shard const &
+{
+	return shards[dependency.qwords[0] % shards.size ()];
 }
 
 nano::container_info nano::unchecked_map::container_info () const
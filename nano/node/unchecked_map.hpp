@@ -11,7 +11,11 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <thread>
+#include <vector>
 
 namespace mi = boost::multi_index;
 
@@ -19,10 +23,16 @@ namespace nano
 {
 class stats;
 
+/**
+ * Blocks waiting for a missing dependency (previous block, source block or epoch open account)
+ * Entries are split by dependency into independently locked shards. The map is bounded both by entry count and by estimated memory,
+ * once either budget is exceeded the oldest entries across all shards are evicted first.
+ * Triggered dependencies are satisfied in parallel by a small pool of threads.
+ */
 class unchecked_map
 {
 public:
-	unchecked_map (unsigned const max_unchecked_blocks, nano::stats &, bool const & do_delete);
+	unchecked_map (unsigned const max_unchecked_blocks, nano::stats &, bool const & do_delete, std::size_t max_unchecked_memory = 64 * 1024 * 1024);
 	~unchecked_map ();
 
 	void start ();
@@ -46,15 +56,22 @@ public:
 	size_t count () const; // Same as `entries_size ()`
 	size_t entries_size () const;
 	size_t queries_size () const;
+	/** Estimated memory used by entries, in bytes */
+	size_t memory () const;
 
 	nano::container_info container_info () const;
 
+	/** Estimated memory used by a single entry */
+	static std::size_t entry_size (nano::unchecked_info const &);
+
 public: // Events
 	nano::observer_set<nano::unchecked_info const &> satisfied;
 
 private:
 	void run ();
 	void query_impl (nano::block_hash const & hash);
+	/** Evicts the oldest entries until both budgets are met */
+	void evict ();
 
 private: // Dependencies
 	nano::stats & stats;
@@ -62,23 +79,26 @@ private: // Dependencies
 private:
 	bool const & disable_delete;
 	std::deque<nano::hash_or_account> buffer;
-	std::deque<nano::hash_or_account> back_buffer;
-	bool writing_back_buffer{ false };
 
 	bool stopped{ false };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex; // Protects queries
-	std::thread thread;
+	std::vector<std::thread> threads;
 
 	unsigned const max_unchecked_blocks;
+	std::size_t const max_unchecked_memory;
 
-	void process_queries (decltype (buffer) const & back_buffer);
+	/** Maximum number of dependencies a thread takes from the query buffer at once */
+	static std::size_t constexpr query_batch_size = 256;
+	static unsigned constexpr thread_count = 4;
 
 private:
 	struct entry
 	{
 		nano::unchecked_key key;
 		nano::unchecked_info info;
+		std::chrono::steady_clock::time_point arrival;
+		std::size_t size;
 	};
 
 	// clang-format off
@@ -91,8 +111,22 @@ private:
 			mi::ordered_unique<mi::tag<tag_root>,
 				mi::member<entry, nano::unchecked_key, &entry::key>>>>;
 	// clang-format on
-	ordered_unchecked entries;
 
-	mutable std::recursive_mutex entries_mutex; // Protects entries
+	/** All entries waiting for the same dependency live in the same shard */
+	class shard final
+	{
+	public:
+		ordered_unchecked entries;
+		mutable nano::mutex mutex; // Protects entries
+	};
+
+	static std::size_t constexpr shard_count = 16;
+
+	shard & shard_for (nano::block_hash const & dependency);
+	shard const & shard_for (nano::block_hash const & dependency) const;
+
+	std::array<shard, shard_count> shards;
+	std::atomic<std::size_t> entries_count{ 0 };
+	std::atomic<std::size_t> memory_m{ 0 };
 };
 }
@@ -27,6 +27,8 @@ bool nano::vote_cache_entry::vote (std::shared_ptr<nano::vote> const & vote, con
 		final_tally_m = final_tally;
 		last_vote_m = std::chrono::steady_clock::now ();
 	}
+	// Replacing a vote of a known voter changes memory usage even if the tally stays the same
+	memory_m = calculate_memory ();
 	return updated;
 }
 
@@ -34,23 +36,32 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 {
 	auto const representative = vote->account;
 
-	if (auto existing = voters.find (representative); existing != voters.end ())
+	auto existing = std::find_if (voters.begin (), voters.end (), [&representative] (auto const & voter) {
+		return voter.representative == representative;
+	});
+	if (existing != voters.end ())
 	{
 		// We already have a vote from this rep
 		// Update timestamp if newer but tally remains unchanged as we already counted this rep weight
 		// It is not essential to keep tally up to date if rep voting weight changes, elections do tally calculations independently, so in the worst case scenario only our queue ordering will be a bit off
-		if (vote->timestamp () > existing->vote->timestamp ())
+		if (vote->timestamp () > existing->timestamp)
 		{
-			bool was_final = existing->vote->is_final ();
-			voters.modify (existing, [&vote, &rep_weight] (auto & existing) {
-				existing.vote = vote;
-				existing.weight = rep_weight;
-			});
+			bool was_final = existing->is_final ();
+			existing->vote = vote;
+			existing->weight = rep_weight;
+			existing->timestamp = vote->timestamp ();
 			return !was_final && vote->is_final (); // Tally changed only if the vote became final
 		}
 	}
 	else
 	{
+		auto lowest_weight = [this] () {
+			release_assert (!voters.empty ());
+			return std::min_element (voters.begin (), voters.end (), [] (auto const & a, auto const & b) {
+				return a.weight < b.weight;
+			});
+		};
+
 		auto should_add = [&, this] () {
 			if (voters.size () < max_voters)
 			{
@@ -58,22 +69,19 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 			}
 			else
 			{
-				release_assert (!voters.empty ());
-				auto const & min_weight = voters.get<tag_weight> ().begin ()->weight;
-				return rep_weight > min_weight;
+				return rep_weight > lowest_weight ()->weight;
 			}
 		};
 
 		// Vote from a new representative, add it to the list and update tally
 		if (should_add ())
 		{
-			voters.insert ({ representative, rep_weight, vote });
+			voters.push_back ({ representative, rep_weight, vote->timestamp (), vote });
 
 			// If we have reached the maximum number of voters, remove the lowest weight voter
 			if (voters.size () >= max_voters)
 			{
-				release_assert (!voters.empty ());
-				voters.get<tag_weight> ().erase (voters.get<tag_weight> ().begin ());
+				voters.erase (lowest_weight ());
 			}
 
 			return true;
@@ -93,11 +101,37 @@ auto nano::vote_cache_entry::calculate_tally () const -> std::pair<nano::uint128
 	for (auto const & voter : voters)
 	{
 		tally += voter.weight;
-		final_tally += voter.vote->is_final () ? voter.weight : 0;
+		final_tally += voter.is_final () ? voter.weight : 0;
 	}
 	return { tally, final_tally };
 }
 
+std::size_t nano::vote_cache_entry::calculate_memory () const
+{
+	std::size_t result = sizeof (vote_cache_entry) + voters.capacity () * sizeof (voter_entry);
+	for (auto const & voter : voters)
+	{
+		auto vote_size = sizeof (nano::vote);
+		// Votes received from the network also keep their serialized form for relaying
+		if (auto const bytes = voter.vote->wire_bytes ())
+		{
+			vote_size += bytes->size ();
+		}
+		result += vote_size / voter.vote->hashes.size () + sizeof (nano::block_hash);
+	}
+	return result;
+}
+
+std::size_t nano::vote_cache_entry::memory () const
+{
+	return memory_m;
+}
+
+bool nano::vote_cache_entry::voter_entry::is_final () const
+{
+	return nano::vote::is_final_timestamp (timestamp);
+}
+
 std::vector<std::shared_ptr<nano::vote>> nano::vote_cache_entry::votes () const
 {
 	auto r = voters | std::views::transform ([] (auto const & item) { return item.vote; });
@@ -159,7 +193,9 @@ void nano::vote_cache::insert_impl (std::shared_ptr<nano::vote> const & vote, na
 		stats.inc (nano::stat::type::vote_cache, nano::stat::detail::update);
 
 		cache.modify (existing, [this, &vote, &rep_weight] (entry & ent) {
+			memory_m -= ent.memory ();
 			ent.vote (vote, rep_weight, config.max_voters);
+			memory_m += ent.memory ();
 		});
 	}
 	else
@@ -168,13 +204,22 @@ void nano::vote_cache::insert_impl (std::shared_ptr<nano::vote> const & vote, na
 
 		entry cache_entry{ hash };
 		cache_entry.vote (vote, rep_weight, config.max_voters);
-		cache.insert (cache_entry);
+		memory_m += cache_entry.memory ();
+		cache.insert (std::move (cache_entry));
+	}
+	trim ();
+}
 
-		// Remove the oldest entry if we have reached the capacity limit
-		if (cache.size () > config.max_size)
-		{
-			cache.get<tag_sequenced> ().pop_front ();
-		}
+void nano::vote_cache::trim ()
+{
+	debug_assert (!mutex.try_lock ());
+
+	// Remove the oldest entries if we have reached the capacity limits
+	auto & cache_by_sequence = cache.get<tag_sequenced> ();
+	while (!cache_by_sequence.empty () && (cache_by_sequence.size () > config.max_size || memory_m > config.max_memory))
+	{
+		memory_m -= cache_by_sequence.front ().memory ();
+		cache_by_sequence.pop_front ();
 	}
 }
 
@@ -190,6 +235,12 @@ std::size_t nano::vote_cache::size () const
 	return cache.size ();
 }
 
+std::size_t nano::vote_cache::memory () const
+{
+	nano::lock_guard<nano::mutex> lock{ mutex };
+	return memory_m;
+}
+
 std::vector<std::shared_ptr<nano::vote>> nano::vote_cache::find (const nano::block_hash & hash) const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
@@ -210,6 +261,7 @@ bool nano::vote_cache::erase (const nano::block_hash & hash)
 	auto & cache_by_hash = cache.get<tag_hash> ();
 	if (auto existing = cache_by_hash.find (hash); existing != cache_by_hash.end ())
 	{
+		memory_m -= existing->memory ();
 		cache_by_hash.erase (existing);
 		result = true;
 	}
@@ -220,6 +272,7 @@ void nano::vote_cache::clear ()
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
 	cache.clear ();
+	memory_m = 0;
 }
 
 std::deque<nano::vote_cache::top_entry> nano::vote_cache::top (const nano::uint128_t & min_tally)
@@ -269,8 +322,13 @@ void nano::vote_cache::cleanup ()
 
 	auto const cutoff = std::chrono::steady_clock::now () - config.age_cutoff;
 
-	erase_if (cache, [cutoff] (auto const & entry) {
-		return entry.last_vote () < cutoff;
+	erase_if (cache, [this, cutoff] (auto const & entry) {
+		if (entry.last_vote () < cutoff)
+		{
+			memory_m -= entry.memory ();
+			return true;
+		}
+		return false;
 	});
 }
 
@@ -280,6 +338,7 @@ nano::container_info nano::vote_cache::container_info () const
 
 	nano::container_info info;
 	info.put ("cache", cache);
+	info.put ("memory", memory_m);
 	return info;
 }
 
@@ -292,6 +351,7 @@ nano::error nano::vote_cache_config::serialize (nano::tomlconfig & toml) const
 	toml.put ("max_size", max_size, "Maximum number of blocks to cache votes for. \ntype:uint64");
 	toml.put ("max_voters", max_voters, "Maximum number of voters to cache per block. \ntype:uint64");
 	toml.put ("age_cutoff", age_cutoff.count (), "Maximum age of votes to keep in cache. \ntype:seconds");
+	toml.put ("max_memory", max_memory, "Maximum memory used by cached votes, in bytes. Votes for the oldest blocks are evicted first once exceeded. \ntype:uint64");
 
 	return toml.get_error ();
 }
@@ -300,6 +360,7 @@ nano::error nano::vote_cache_config::deserialize (nano::tomlconfig & toml)
 {
 	toml.get ("max_size", max_size);
 	toml.get ("max_voters", max_voters);
+	toml.get ("max_memory", max_memory);
 
 	auto age_cutoff_l = age_cutoff.count ();
 	toml.get ("age_cutoff", age_cutoff_l);
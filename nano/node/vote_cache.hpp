@@ -36,6 +36,8 @@ public:
 	std::size_t max_size{ 1024 * 64 };
 	std::size_t max_voters{ 64 };
 	std::chrono::seconds age_cutoff{ 15 * 60 };
+	/** Memory budget in bytes for cached entries including their share of the cached votes */
+	std::size_t max_memory{ 256 * 1024 * 1024 };
 };
 
 /**
@@ -48,7 +50,11 @@ private:
 	{
 		nano::account representative;
 		nano::uint128_t weight;
+		uint64_t timestamp;
+		// Votes are kept whole as their signature covers every hash they contain, they are shared between entries of all those hashes
 		std::shared_ptr<nano::vote> vote;
+
+		bool is_final () const;
 	};
 
 public:
@@ -62,6 +68,8 @@ public:
 
 	std::size_t size () const;
 	std::vector<std::shared_ptr<nano::vote>> votes () const;
+	/** Estimated memory used by this entry, votes are charged evenly to each hash they contain */
+	std::size_t memory () const;
 
 public: // Keep accessors inlined
 	nano::block_hash hash () const
@@ -84,27 +92,16 @@ public: // Keep accessors inlined
 private:
 	bool vote_impl (std::shared_ptr<nano::vote> const & vote, nano::uint128_t const & rep_weight, std::size_t max_voters);
 	std::pair<nano::uint128_t, nano::uint128_t> calculate_tally () const; // <tally, final_tally>
+	std::size_t calculate_memory () const;
 
-	// clang-format off
-	class tag_representative {};
-	class tag_weight {};
-	// clang-format on
-
-	// clang-format off
-	using ordered_voters = boost::multi_index_container<voter_entry,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_representative>,
-			mi::member<voter_entry, nano::account, &voter_entry::representative>>,
-		mi::ordered_non_unique<mi::tag<tag_weight>,
-			mi::member<voter_entry, nano::uint128_t, &voter_entry::weight>>
-	>>;
-	// clang-format on
-	ordered_voters voters;
+	// Number of voters is bounded by `max_voters`, a flat array is smaller and faster to scan than an indexed container
+	std::vector<voter_entry> voters;
 
 	nano::block_hash const hash_m;
 	std::chrono::steady_clock::time_point last_vote_m{};
 	nano::uint128_t tally_m{ 0 };
 	nano::uint128_t final_tally_m{ 0 };
+	std::size_t memory_m{ 0 };
 };
 
 class vote_cache final
@@ -136,6 +133,8 @@ public:
 
 	std::size_t size () const;
 	bool empty () const;
+	/** Estimated memory used by cached entries in bytes */
+	std::size_t memory () const;
 
 	struct top_entry
 	{
@@ -166,6 +165,8 @@ private: // Dependencies
 private:
 	void insert_impl (std::shared_ptr<nano::vote> const &, nano::block_hash const & hash, nano::uint128_t const & rep_weight);
 	void cleanup ();
+	/** Removes the oldest entries until both the size and memory limits are met */
+	void trim ();
 
 	// clang-format off
 	class tag_sequenced {};
@@ -184,6 +185,7 @@ private:
 	>>;
 	// clang-format on
 	ordered_cache cache;
+	std::size_t memory_m{ 0 };
 
 	mutable nano::mutex mutex;
 	nano::interval cleanup_interval;
@@ -1,5 +1,6 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/stats.hpp>
+#include <nano/lib/stream.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/local_vote_history.hpp>
 #include <nano/node/network.hpp>
@@ -266,6 +267,13 @@ void nano::vote_generator::vote (std::vector<nano::block_hash> const & hashes_a,
 	});
 	for (auto const & vote_l : votes_l)
 	{
+		// Generated votes are sent to many peers and replayed from history, serialize them only once
+		auto bytes = std::make_shared<std::vector<uint8_t>> ();
+		{
+			nano::vectorstream stream{ *bytes };
+			vote_l->serialize (stream);
+		}
+		vote_l->wire_bytes_set (bytes);
 		for (std::size_t i (0), n (hashes_a.size ()); i != n; ++i)
 		{
 			history.add (roots_a[i], hashes_a[i], vote_l);
@@ -160,10 +160,14 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 
 	lock.unlock ();
 
+	auto const valid = verify_batch (batch);
+	debug_assert (valid.size () == batch.size ());
+
+	std::size_t index = 0;
 	for (auto const & [item, origin] : batch)
 	{
 		auto const & [vote, source] = item;
-		vote_blocking (vote, origin.channel, source);
+		process (vote, origin.channel, source, valid[index++]);
 	}
 
 	total_processed += batch.size ();
@@ -177,10 +181,54 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 	}
 }
 
+std::vector<bool> nano::vote_processor::verify_batch (std::deque<queue_t::value_type> const & batch) const
+{
+	auto const count = batch.size ();
+
+	// Signed vote hashes need to stay in place while their pointers are passed to the batch verifier
+	std::vector<nano::block_hash> hashes;
+	hashes.reserve (count);
+	std::vector<unsigned char const *> messages;
+	messages.reserve (count);
+	std::vector<size_t> lengths;
+	lengths.reserve (count);
+	std::vector<unsigned char const *> public_keys;
+	public_keys.reserve (count);
+	std::vector<unsigned char const *> signatures;
+	signatures.reserve (count);
+
+	for (auto const & [item, origin] : batch)
+	{
+		auto const & vote = item.first;
+		hashes.push_back (vote->hash ());
+		messages.push_back (hashes.back ().bytes.data ());
+		lengths.push_back (sizeof (nano::block_hash));
+		public_keys.push_back (vote->account.bytes.data ());
+		signatures.push_back (vote->signature.bytes.data ());
+	}
+
+	std::vector<int> valid (count, 0);
+	if (count > 0)
+	{
+		if (nano::validate_message_batch (messages.data (), lengths.data (), public_keys.data (), signatures.data (), count, valid.data ()))
+		{
+			stats.inc (nano::stat::type::vote_processor, nano::stat::detail::batch_invalid);
+		}
+	}
+	stats.add (nano::stat::type::vote_processor, nano::stat::detail::batch_verified, count);
+
+	return { valid.begin (), valid.end () };
+}
+
 nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source)
+{
+	return process (vote, channel, source, !vote->validate ()); // false => valid vote
+}
+
+nano::vote_code nano::vote_processor::process (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source, bool valid)
 {
 	auto result = nano::vote_code::invalid;
-	if (!vote->validate ()) // false => valid vote
+	if (valid)
 	{
 		auto vote_results = vote_router.vote (vote, source);
 
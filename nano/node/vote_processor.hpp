@@ -74,7 +74,13 @@ private:
 
 private:
 	using entry_t = std::pair<std::shared_ptr<nano::vote>, nano::vote_source>;
-	nano::fair_queue<entry_t, nano::rep_tier> queue;
+	using queue_t = nano::fair_queue<entry_t, nano::rep_tier>;
+	queue_t queue;
+
+private:
+	/** Verifies signatures of all votes in the batch at once. @returns validity of each entry, in batch order */
+	std::vector<bool> verify_batch (std::deque<queue_t::value_type> const &) const;
+	nano::vote_code process (std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> const &, nano::vote_source, bool valid);
 
 private:
 	bool stopped{ false };
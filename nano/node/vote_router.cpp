@@ -23,7 +23,8 @@ nano::stat::detail nano::to_stat_detail (nano::vote_source source)
 
 nano::vote_router::vote_router (nano::vote_cache & vote_cache_a, nano::recently_confirmed_cache & recently_confirmed_a) :
 	vote_cache{ vote_cache_a },
-	recently_confirmed{ recently_confirmed_a }
+	recently_confirmed{ recently_confirmed_a },
+	elections{ std::make_shared<table> (initial_capacity) }
 {
 }
 
@@ -35,24 +36,99 @@ nano::vote_router::~vote_router ()
 
 void nano::vote_router::connect (nano::block_hash const & hash, std::weak_ptr<nano::election> election)
 {
-	std::unique_lock lock{ mutex };
-	elections.insert_or_assign (hash, election);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	reserve_slot ();
+	auto & table_l = elections.latest ();
+	auto & slot = table_l.slot (hash);
+	if (slot.load (std::memory_order_relaxed) == nullptr)
+	{
+		++table_l.used;
+		++count;
+	}
+	slot.store (table_l.make_route (hash, std::move (election)), std::memory_order_release);
 }
 
 void nano::vote_router::disconnect (nano::election const & election)
 {
-	std::unique_lock lock{ mutex };
+	nano::lock_guard<nano::mutex> guard{ mutex };
 	for (auto const & [hash, _] : election.blocks ())
 	{
-		elections.erase (hash);
+		erase (hash);
 	}
 }
 
 void nano::vote_router::disconnect (nano::block_hash const & hash)
 {
-	std::unique_lock lock{ mutex };
-	[[maybe_unused]] auto erased = elections.erase (hash);
-	debug_assert (erased == 1);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	[[maybe_unused]] auto erased = erase (hash);
+	debug_assert (erased);
+}
+
+bool nano::vote_router::erase (nano::block_hash const & hash)
+{
+	debug_assert (!mutex.try_lock ());
+	auto & table_l = elections.latest ();
+	auto & slot = table_l.slot (hash);
+	if (slot.load (std::memory_order_relaxed) == nullptr)
+	{
+		return false;
+	}
+	slot.store (&table_l.tombstone, std::memory_order_release);
+	--count;
+	return true;
+}
+
+void nano::vote_router::erase_expired ()
+{
+	debug_assert (!mutex.try_lock ());
+	auto & table_l = elections.latest ();
+	for (std::size_t i = 0; i < table_l.capacity; ++i)
+	{
+		auto & slot = table_l.slots[i];
+		if (auto existing = slot.load (std::memory_order_relaxed); existing != nullptr && existing != &table_l.tombstone && existing->election.expired ())
+		{
+			slot.store (&table_l.tombstone, std::memory_order_release);
+			--count;
+		}
+	}
+}
+
+void nano::vote_router::reserve_slot ()
+{
+	debug_assert (!mutex.try_lock ());
+	auto const & table_l = elections.latest ();
+	// Keep the load factor below one half so probe sequences stay short and always end at an empty slot
+	// Routes replaced by a later connect are only freed with their table, which bounds how many are kept around
+	if ((table_l.used + 1) * 2 <= table_l.capacity && table_l.routes.size () < table_l.capacity)
+	{
+		return;
+	}
+	// Size the new table for the live routes only, tombstones are dropped
+	auto capacity = initial_capacity;
+	while (capacity < (count + 1) * 4)
+	{
+		capacity *= 2;
+	}
+	auto next = std::make_shared<table> (capacity);
+	for (std::size_t i = 0; i < table_l.capacity; ++i)
+	{
+		if (auto existing = table_l.slots[i].load (std::memory_order_relaxed); existing != nullptr && existing != &table_l.tombstone)
+		{
+			next->slot (existing->hash).store (next->make_route (existing->hash, existing->election), std::memory_order_relaxed);
+			++next->used;
+		}
+	}
+	// Readers still probing the previous table keep it alive and see the routes as they were before this call
+	elections.publish (std::move (next));
+}
+
+std::shared_ptr<nano::election> nano::vote_router::find (nano::block_hash const & hash) const
+{
+	if (auto const * existing = elections.get ()->find (hash))
+	{
+		return existing->election.lock ();
+	}
+	return nullptr;
 }
 
 // Validate a vote and apply it to the current election if one exists
@@ -66,44 +142,33 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 
 	std::unordered_map<nano::block_hash, nano::vote_code> results;
 	std::unordered_map<nano::block_hash, std::shared_ptr<nano::election>> process;
+	for (auto const & hash : vote->hashes)
 	{
-		std::shared_lock lock{ mutex };
-		for (auto const & hash : vote->hashes)
+		// Ignore votes for other hashes if a filter is set
+		if (!filter.is_zero () && hash != filter)
 		{
-			// Ignore votes for other hashes if a filter is set
-			if (!filter.is_zero () && hash != filter)
-			{
-				continue;
-			}
-
-			// Ignore duplicate hashes (should not happen with a well-behaved voting node)
-			if (results.find (hash) != results.end ())
-			{
-				continue;
-			}
+			continue;
+		}
 
-			auto find_election = [this] (auto const & hash) -> std::shared_ptr<nano::election> {
-				if (auto existing = elections.find (hash); existing != elections.end ())
-				{
-					return existing->second.lock ();
-				}
-				return {};
-			};
+		// Ignore duplicate hashes (should not happen with a well-behaved voting node)
+		if (results.find (hash) != results.end ())
+		{
+			continue;
+		}
 
-			if (auto election = find_election (hash))
+		if (auto election = find (hash))
+		{
+			process[hash] = election;
+		}
+		else
+		{
+			if (!recently_confirmed.exists (hash))
 			{
-				process[hash] = election;
+				results[hash] = nano::vote_code::indeterminate;
 			}
 			else
 			{
-				if (!recently_confirmed.exists (hash))
-				{
-					results[hash] = nano::vote_code::indeterminate;
-				}
-				else
-				{
-					results[hash] = nano::vote_code::replay;
-				}
+				results[hash] = nano::vote_code::replay;
 			}
 		}
 	}
@@ -132,28 +197,12 @@ std::unordered_map<nano::block_hash, nano::vote_code> nano::vote_router::vote (s
 
 bool nano::vote_router::active (nano::block_hash const & hash) const
 {
-	std::shared_lock lock{ mutex };
-	if (auto existing = elections.find (hash); existing != elections.end ())
-	{
-		if (auto election = existing->second.lock (); election != nullptr)
-		{
-			return true;
-		}
-	}
-	return false;
+	return find (hash) != nullptr;
 }
 
 std::shared_ptr<nano::election> nano::vote_router::election (nano::block_hash const & hash) const
 {
-	std::shared_lock lock{ mutex };
-	if (auto existing = elections.find (hash); existing != elections.end ())
-	{
-		if (auto election = existing->second.lock (); election != nullptr)
-		{
-			return election;
-		}
-	}
-	return nullptr;
+	return find (hash);
 }
 
 void nano::vote_router::start ()
@@ -166,7 +215,7 @@ void nano::vote_router::start ()
 
 void nano::vote_router::stop ()
 {
-	std::unique_lock lock{ mutex };
+	nano::unique_lock<nano::mutex> lock{ mutex };
 	stopped = true;
 	lock.unlock ();
 	condition.notify_all ();
@@ -178,19 +227,64 @@ void nano::vote_router::stop ()
 
 void nano::vote_router::run ()
 {
-	std::unique_lock lock{ mutex };
+	nano::unique_lock<nano::mutex> lock{ mutex };
 	while (!stopped)
 	{
-		std::erase_if (elections, [] (auto const & pair) { return pair.second.lock () == nullptr; });
+		erase_expired ();
 		condition.wait_for (lock, 15s, [&] () { return stopped; });
 	}
 }
 
 nano::container_info nano::vote_router::container_info () const
 {
-	std::shared_lock lock{ mutex };
-
 	nano::container_info info;
-	info.put ("elections", elections);
+	info.put ("elections", count.load (), sizeof (route));
 	return info;
 }
+
+/*
+ * table
+ */
+
+nano::vote_router::table::table (std::size_t capacity_a) :
+	capacity{ capacity_a },
+	slots{ std::make_unique<std::atomic<route const *>[]> (capacity_a) }
+{
+	debug_assert (capacity > 0 && (capacity & (capacity - 1)) == 0);
+}
+
+auto nano::vote_router::table::find (nano::block_hash const & hash) const -> route const *
+{
+	auto const mask = capacity - 1;
+	// Block hashes are already uniformly distributed
+	auto index = static_cast<std::size_t> (hash.qwords[0]) & mask;
+	while (auto const * existing = slots[index].load (std::memory_order_acquire))
+	{
+		if (existing != &tombstone && existing->hash == hash)
+		{
+			return existing;
+		}
+		index = (index + 1) & mask;
+	}
+	return nullptr;
+}
+
+auto nano::vote_router::table::slot (nano::block_hash const & hash) -> std::atomic<route const *> &
+{
+	auto const mask = capacity - 1;
+	auto index = static_cast<std::size_t> (hash.qwords[0]) & mask;
+	while (auto const * existing = slots[index].load (std::memory_order_relaxed))
+	{
+		if (existing != &tombstone && existing->hash == hash)
+		{
+			break;
+		}
+		index = (index + 1) & mask;
+	}
+	return slots[index];
+}
+
+auto nano::vote_router::table::make_route (nano::block_hash const & hash, std::weak_ptr<nano::election> election) -> route const *
+{
+	return &routes.emplace_back (route{ hash, std::move (election) });
+}
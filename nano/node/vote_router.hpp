@@ -1,11 +1,15 @@
 #pragma once
 
+#include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/numbers_templ.hpp>
+#include <nano/lib/observer_set.hpp>
+#include <nano/lib/versioned_snapshot.hpp>
 #include <nano/node/fwd.hpp>
 
+#include <atomic>
+#include <deque>
 #include <memory>
-#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -34,6 +38,7 @@ nano::stat::detail to_stat_detail (vote_source);
 // This class routes votes to their associated election
 // This class holds a weak_ptr as this container does not own the elections
 // Routing entries are removed periodically if the weak_ptr has expired
+// Lookups do not take a lock or touch a shared reference count so vote processing threads do not contend with each other, only connecting and disconnecting elections is serialized
 class vote_router final
 {
 public:
@@ -70,15 +75,61 @@ private: // Dependencies
 
 private:
 	void run ();
+	std::shared_ptr<nano::election> find (nano::block_hash const & hash) const;
+	/** Returns true if a route for 'hash' was removed. Must be called with `mutex` held */
+	bool erase (nano::block_hash const & hash);
+	/** Must be called with `mutex` held */
+	void erase_expired ();
+	/** Builds a new table holding only live routes once the current one is half full or holds too many replaced routes. Must be called with `mutex` held */
+	void reserve_slot ();
 
 private:
+	class route final
+	{
+	public:
+		nano::block_hash hash;
+		std::weak_ptr<nano::election> election;
+	};
+
+	/**
+	 * Fixed capacity open addressing table with linear probing
+	 * Each slot is published atomically, readers probe without locking while the single writer replaces slots
+	 * Routes are owned by the table and live as long as it does, so readers can follow slots without reference counting
+	 */
+	class table final
+	{
+	public:
+		explicit table (std::size_t capacity);
+
+		route const * find (nano::block_hash const & hash) const;
+		/** Slot holding the route for 'hash' or the first empty slot of its probe sequence */
+		std::atomic<route const *> & slot (nano::block_hash const & hash);
+		/** Creates a route owned by this table. Only called by the writer */
+		route const * make_route (nano::block_hash const & hash, std::weak_ptr<nano::election> election);
+
+		std::size_t const capacity;
+		std::unique_ptr<std::atomic<route const *>[]> slots;
+		/** Slots are never emptied as that would break probe sequences, erased routes are replaced by `tombstone` instead */
+		route const tombstone{};
+		/** Every route stored in this table, including replaced and erased ones. Only accessed by the writer */
+		std::deque<route> routes;
+		/** Number of non-empty slots, including tombstones. Only accessed by the writer */
+		std::size_t used{ 0 };
+	};
+
+	static std::size_t constexpr initial_capacity = 1024;
+
 	// Mapping of block hashes to elections.
 	// Election already contains the associated block
-	std::unordered_map<nano::block_hash, std::weak_ptr<nano::election>> elections;
+	// The writer updates slots of the latest table in place and only publishes a new table when rebuilding it
+	nano::versioned_snapshot<table> elections;
+	/** Number of live routes */
+	std::atomic<std::size_t> count{ 0 };
 
 	bool stopped{ false };
-	std::condition_variable_any condition;
-	mutable std::shared_mutex mutex;
+	nano::condition_variable condition;
+	/** Serializes writers */
+	mutable nano::mutex mutex;
 	std::thread thread;
 };
 }
@@ -0,0 +1,155 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/lib/tomlconfig.hpp>
+#include <nano/secure/block_cache.hpp>
+
+nano::block_cache::block_cache (nano::block_cache_config const & config_a, nano::stats & stats_a) :
+	config{ config_a },
+	stats{ stats_a }
+{
+}
+
+void nano::block_cache::put (std::shared_ptr<nano::block> const & block)
+{
+	debug_assert (block);
+	debug_assert (block->has_sideband ());
+
+	auto const max_memory = config.max_size / shards.size ();
+	if (max_memory == 0)
+	{
+		return; // Disabled
+	}
+
+	auto const hash = block->hash ();
+	auto const size = entry_size (*block);
+	auto & shard = shard_for (hash);
+
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+
+	auto & blocks_by_hash = shard.blocks.get<tag_hash> ();
+	if (auto existing = blocks_by_hash.find (hash); existing != blocks_by_hash.end ())
+	{
+		shard.memory -= existing->size;
+		blocks_by_hash.erase (existing);
+	}
+	shard.blocks.get<tag_sequenced> ().push_back ({ hash, block, size });
+	shard.memory += size;
+
+	stats.inc (nano::stat::type::block_cache, nano::stat::detail::insert);
+
+	// Evict least recently used blocks
+	while (shard.memory > max_memory && !shard.blocks.empty ())
+	{
+		auto & blocks_sequenced = shard.blocks.get<tag_sequenced> ();
+		shard.memory -= blocks_sequenced.front ().size;
+		blocks_sequenced.pop_front ();
+
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::evicted);
+	}
+}
+
+std::shared_ptr<nano::block> nano::block_cache::get (nano::block_hash const & hash)
+{
+	auto & shard = shard_for (hash);
+
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+
+	auto & blocks_by_hash = shard.blocks.get<tag_hash> ();
+	if (auto existing = blocks_by_hash.find (hash); existing != blocks_by_hash.end ())
+	{
+		// Move to the back of the eviction order
+		auto & blocks_sequenced = shard.blocks.get<tag_sequenced> ();
+		blocks_sequenced.relocate (blocks_sequenced.end (), shard.blocks.project<tag_sequenced> (existing));
+
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::hit);
+		return existing->block;
+	}
+
+	stats.inc (nano::stat::type::block_cache, nano::stat::detail::miss);
+	return nullptr;
+}
+
+void nano::block_cache::erase (nano::block_hash const & hash)
+{
+	auto & shard = shard_for (hash);
+
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+
+	auto & blocks_by_hash = shard.blocks.get<tag_hash> ();
+	if (auto existing = blocks_by_hash.find (hash); existing != blocks_by_hash.end ())
+	{
+		shard.memory -= existing->size;
+		blocks_by_hash.erase (existing);
+
+		stats.inc (nano::stat::type::block_cache, nano::stat::detail::erased);
+	}
+}
+
+void nano::block_cache::clear ()
+{
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		shard.blocks.clear ();
+		shard.memory = 0;
+	}
+}
+
+std::size_t nano::block_cache::size () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		result += shard.blocks.size ();
+	}
+	return result;
+}
+
+std::size_t nano::block_cache::memory () const
+{
+	std::size_t result = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		result += shard.memory;
+	}
+	return result;
+}
+
+nano::container_info nano::block_cache::container_info () const
+{
+	nano::container_info info;
+	info.put ("blocks", size ());
+	info.put ("memory", memory ());
+	return info;
+}
+
+std::size_t nano::block_cache::entry_size (nano::block const & block)
+{
+	// Serialized size approximates the in-memory block, plus shared_ptr control block and container node overhead
+	return nano::block::size (block.type ()) + nano::block_sideband::size (block.type ()) + sizeof (entry) + 64;
+}
+
+auto nano::block_cache::shard_for (nano::block_hash const & hash) -> shard &
+{
+	return shards[hash.qwords[0] % shards.size ()];
+}
+
+/*
+ * block_cache_config
+ */
+
+nano::error nano::block_cache_config::serialize (nano::tomlconfig & toml) const
+{
+	toml.put ("max_size", max_size, "Maximum memory used by the cache of recently written blocks, in bytes. Zero disables the cache. \ntype:uint64");
+
+	return toml.get_error ();
+}
+
+nano::error nano::block_cache_config::deserialize (nano::tomlconfig & toml)
+{
+	toml.get ("max_size", max_size);
+
+	return toml.get_error ();
+}
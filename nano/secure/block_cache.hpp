@@ -0,0 +1,105 @@
+#pragma once
+
+#include <nano/lib/container_info.hpp>
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/numbers_templ.hpp>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace mi = boost::multi_index;
+
+namespace nano
+{
+class block;
+class error;
+class stats;
+class tomlconfig;
+}
+
+namespace nano
+{
+class block_cache_config final
+{
+public:
+	nano::error deserialize (nano::tomlconfig & toml);
+	nano::error serialize (nano::tomlconfig & toml) const;
+
+public:
+	/** Maximum memory used by cached blocks, in bytes. Zero disables the cache */
+	std::size_t max_size{ 64 * 1024 * 1024 };
+};
+
+/**
+ * Least recently used cache of deserialized blocks, including their sideband, keyed by block hash
+ * Blocks are inserted when written by the ledger and must be erased whenever their stored representation changes (rollback, successor update, pruning),
+ * so the cache always reflects the most recently written ledger state, the same way the ledger_cache counters do
+ */
+class block_cache final
+{
+public:
+	block_cache (nano::block_cache_config const &, nano::stats &);
+
+	void put (std::shared_ptr<nano::block> const &);
+	/** Returns nullptr if the block is not cached */
+	std::shared_ptr<nano::block> get (nano::block_hash const &);
+	void erase (nano::block_hash const &);
+	void clear ();
+
+	std::size_t size () const;
+	/** Estimated memory used by cached blocks, in bytes */
+	std::size_t memory () const;
+
+	nano::container_info container_info () const;
+
+	/** Estimated memory used by a single cached block */
+	static std::size_t entry_size (nano::block const &);
+
+private:
+	class entry final
+	{
+	public:
+		nano::block_hash hash;
+		std::shared_ptr<nano::block> block;
+		std::size_t size;
+	};
+
+	// clang-format off
+	class tag_sequenced {};
+	class tag_hash {};
+
+	using ordered_blocks = boost::multi_index_container<entry,
+	mi::indexed_by<
+		mi::sequenced<mi::tag<tag_sequenced>>,
+		mi::hashed_unique<mi::tag<tag_hash>,
+			mi::member<entry, nano::block_hash, &entry::hash>>
+	>>;
+	// clang-format on
+
+	/** Blocks are split by hash into independently locked shards, each limited to an equal part of the memory budget */
+	class shard final
+	{
+	public:
+		ordered_blocks blocks;
+		std::size_t memory{ 0 };
+		mutable nano::mutex mutex;
+	};
+
+	static std::size_t constexpr shard_count = 16;
+
+	shard & shard_for (nano::block_hash const &);
+
+private:
+	nano::block_cache_config const config;
+	nano::stats & stats;
+
+	std::array<shard, shard_count> shards;
+};
+}
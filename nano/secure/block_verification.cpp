@@ -0,0 +1,35 @@
+#include <nano/lib/blocks.hpp>
+#include <nano/secure/block_verification.hpp>
+#include <nano/secure/common.hpp>
+
+#include <algorithm>
+
+nano::block_verification nano::block_verification::verify (nano::block const & block, nano::ledger_constants const & constants)
+{
+	nano::block_verification result;
+	auto const hash = block.hash ();
+	if (auto account = block.account_field ())
+	{
+		result.signatures.emplace_back (*account, !nano::validate_message (*account, hash, block.block_signature ()));
+
+		// State blocks with an epoch link are either sends to the epoch link account or epoch blocks, the balance decides which one so check both signers
+		auto link = block.link_field ();
+		if (link && constants.epochs.is_epoch_link (*link))
+		{
+			auto const & signer = constants.epochs.signer (constants.epochs.epoch (*link));
+			result.signatures.emplace_back (signer, !nano::validate_message (signer, hash, block.block_signature ()));
+		}
+	}
+	result.difficulty = constants.work.difficulty (block);
+	return result;
+}
+
+std::optional<bool> nano::block_verification::signature_valid (nano::account const & signer) const
+{
+	auto existing = std::find_if (signatures.begin (), signatures.end (), [&signer] (auto const & entry) { return entry.first == signer; });
+	if (existing != signatures.end ())
+	{
+		return existing->second;
+	}
+	return std::nullopt;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <nano/lib/fwd.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/secure/fwd.hpp>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Results of the stateless block checks (signature and work difficulty) that can be done without a ledger transaction.
+ * The signer is only known upfront for blocks carrying an account field (open and state blocks), for state blocks with an epoch link both the account and the epoch signer are checked.
+ * Checks that were not done ahead of time are performed by the ledger as usual.
+ */
+class block_verification final
+{
+public:
+	/** Compute the checks for the block */
+	static nano::block_verification verify (nano::block const &, nano::ledger_constants const &);
+
+	/** @returns whether the block signature is valid for the signer or nullopt if the signer was not checked */
+	std::optional<bool> signature_valid (nano::account const & signer) const;
+
+public:
+	// Signers the signature was checked against, paired with the result (true => valid)
+	std::vector<std::pair<nano::account, bool>> signatures;
+	// Block work difficulty, the required threshold depends on ledger state and is checked by the ledger
+	std::optional<uint64_t> difficulty;
+};
+}
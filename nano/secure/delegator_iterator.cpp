@@ -0,0 +1,4 @@
+#include <nano/secure/delegator_iterator_impl.hpp>
+#include <nano/secure/ledger_set_any.hpp>
+
+template class nano::delegator_iterator<nano::ledger_set_any>;
@@ -0,0 +1,41 @@
+#pragma once
+#include <nano/lib/numbers.hpp>
+#include <nano/secure/account_info.hpp>
+#include <nano/secure/delegator_key.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace nano::secure
+{
+class transaction;
+}
+
+namespace nano
+{
+// This class iterates the accounts delegating to a representative, ordered by account
+template <typename Set>
+class delegator_iterator
+{
+public:
+	// Creates an end () iterator
+	// 'transaction' and 'set' are nullptr so all end () iterators compare equal
+	// 'representative' is set to 0 so all end () iterators compare equal.
+	delegator_iterator ();
+	delegator_iterator (secure::transaction const & transaction, Set const & set, std::optional<std::pair<nano::delegator_key, nano::account_info>> const & item);
+	bool operator== (delegator_iterator const & other) const;
+
+public: // Dereferencing, undefined behavior when called on an end () iterator
+	// Advances to the next account delegating to the same representative
+	// If there are no more delegators, convert this to an end () iterator.
+	delegator_iterator & operator++ ();
+	std::pair<nano::delegator_key, nano::account_info> const & operator* () const;
+	std::pair<nano::delegator_key, nano::account_info> const * operator->() const;
+
+private:
+	secure::transaction const * transaction;
+	Set const * set{ nullptr };
+	nano::account representative{ 0 };
+	std::optional<std::pair<nano::delegator_key, nano::account_info>> item;
+};
+}
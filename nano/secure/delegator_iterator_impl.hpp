@@ -0,0 +1,59 @@
+#include <nano/lib/utility.hpp>
+#include <nano/secure/account_info.hpp>
+#include <nano/secure/delegator_iterator.hpp>
+
+template <typename Set>
+nano::delegator_iterator<Set>::delegator_iterator ()
+{
+}
+
+template <typename Set>
+nano::delegator_iterator<Set>::delegator_iterator (secure::transaction const & transaction, Set const & set, std::optional<std::pair<nano::delegator_key, nano::account_info>> const & item) :
+	transaction{ &transaction },
+	set{ &set },
+	item{ item }
+{
+	if (item.has_value ())
+	{
+		representative = item.value ().first.representative;
+	}
+}
+
+template <typename Set>
+bool nano::delegator_iterator<Set>::operator== (delegator_iterator const & other) const
+{
+	debug_assert (set == nullptr || other.set == nullptr || set == other.set);
+	debug_assert (representative.is_zero () || other.representative.is_zero () || representative == other.representative);
+	return item == other.item;
+}
+
+template <typename Set>
+auto nano::delegator_iterator<Set>::operator++ () -> delegator_iterator<Set> &
+{
+	auto next = item.value ().first.account.number () + 1;
+	if (next != 0)
+	{
+		item = set->delegator_lower_bound (*transaction, representative, next);
+	}
+	else
+	{
+		item = std::nullopt;
+	}
+	if (item && item.value ().first.representative != representative)
+	{
+		item = std::nullopt;
+	}
+	return *this;
+}
+
+template <typename Set>
+std::pair<nano::delegator_key, nano::account_info> const & nano::delegator_iterator<Set>::operator* () const
+{
+	return item.value ();
+}
+
+template <typename Set>
+std::pair<nano::delegator_key, nano::account_info> const * nano::delegator_iterator<Set>::operator->() const
+{
+	return &item.value ();
+}
@@ -0,0 +1,17 @@
+#include <nano/secure/delegator_key.hpp>
+
+nano::delegator_key::delegator_key (nano::account const & representative_a, nano::account const & account_a) :
+	representative (representative_a),
+	account (account_a)
+{
+}
+
+bool nano::delegator_key::operator== (nano::delegator_key const & other_a) const
+{
+	return representative == other_a.representative && account == other_a.account;
+}
+
+bool nano::delegator_key::operator< (nano::delegator_key const & other_a) const
+{
+	return representative == other_a.representative ? account < other_a.account : representative < other_a.representative;
+}
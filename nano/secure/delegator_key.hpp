@@ -0,0 +1,42 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/numbers_templ.hpp>
+
+#include <functional>
+#include <ostream>
+
+namespace nano
+{
+/**
+ * Key of the delegators table, ordered by representative so all accounts delegating to a representative are contiguous
+ */
+class delegator_key final
+{
+public:
+	delegator_key () = default;
+	delegator_key (nano::account const & representative, nano::account const & account);
+	bool operator== (nano::delegator_key const &) const;
+	bool operator< (nano::delegator_key const &) const;
+	nano::account representative{};
+	nano::account account{}; // delegating account
+
+	friend std::ostream & operator<< (std::ostream & os, const nano::delegator_key & key)
+	{
+		os << "Representative: " << key.representative << ", Account: " << key.account;
+		return os;
+	}
+};
+}
+
+namespace std
+{
+template <>
+struct hash<::nano::delegator_key>
+{
+	size_t operator() (::nano::delegator_key const & value) const
+	{
+		return hash<::nano::uint512_union>{}({ value.representative, value.account });
+	}
+};
+}
@@ -0,0 +1,41 @@
+#include <nano/secure/height_key.hpp>
+
+#include <boost/endian/conversion.hpp>
+
+nano::height_key::height_key (nano::account const & account_a, uint64_t height_a) :
+	account (account_a),
+	height (height_a)
+{
+}
+
+bool nano::height_key::operator== (nano::height_key const & other_a) const
+{
+	return account == other_a.account && height == other_a.height;
+}
+
+bool nano::height_key::operator< (nano::height_key const & other_a) const
+{
+	return account == other_a.account ? height < other_a.height : account < other_a.account;
+}
+
+void nano::height_key::serialize (nano::stream & stream_a) const
+{
+	nano::write (stream_a, account);
+	nano::write (stream_a, boost::endian::native_to_big (height));
+}
+
+bool nano::height_key::deserialize (nano::stream & stream_a)
+{
+	auto error (false);
+	try
+	{
+		nano::read (stream_a, account);
+		nano::read (stream_a, height);
+		boost::endian::big_to_native_inplace (height);
+	}
+	catch (std::runtime_error const &)
+	{
+		error = true;
+	}
+	return error;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/numbers_templ.hpp>
+#include <nano/lib/stream.hpp>
+
+#include <functional>
+#include <ostream>
+
+namespace nano
+{
+/**
+ * Key of the heights table, ordered by account then height so every account chain is stored contiguously in chain order
+ * The height is serialized big endian so the database ordering matches numeric ordering
+ */
+class height_key final
+{
+public:
+	height_key () = default;
+	height_key (nano::account const & account, uint64_t height);
+	bool operator== (nano::height_key const &) const;
+	bool operator< (nano::height_key const &) const;
+	void serialize (nano::stream &) const;
+	bool deserialize (nano::stream &);
+	nano::account account{};
+	uint64_t height{ 0 };
+
+	static std::size_t constexpr size = sizeof (nano::account) + sizeof (uint64_t);
+
+	friend std::ostream & operator<< (std::ostream & os, const nano::height_key & key)
+	{
+		os << "Account: " << key.account << ", Height: " << key.height;
+		return os;
+	}
+};
+}
+
+namespace std
+{
+template <>
+struct hash<::nano::height_key>
+{
+	size_t operator() (::nano::height_key const & value) const
+	{
+		return hash<::nano::account>{}(value.account) ^ hash<uint64_t>{}(value.height);
+	}
+};
+}
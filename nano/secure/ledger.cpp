@@ -3,9 +3,9 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/stats.hpp>
+#include <nano/lib/stream.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/lib/work.hpp>
-#include <nano/node/make_store.hpp>
 #include <nano/secure/common.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
@@ -15,12 +15,17 @@
 #include <nano/store/block.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/delegator.hpp>
 #include <nano/store/final_vote.hpp>
+#include <nano/store/height.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
 #include <nano/store/online_weight.hpp>
 #include <nano/store/peer.hpp>
 #include <nano/store/pending.hpp>
 #include <nano/store/pruned.hpp>
 #include <nano/store/rep_weight.hpp>
+#include <nano/store/rocksdb/lmdb_import.hpp>
+#include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/store/version.hpp>
 
 #include <stack>
@@ -89,8 +94,10 @@ public:
 		auto destination_account = block_a.account ();
 		auto source_account = ledger.any.block_account (transaction, block_a.hashables.source);
 		ledger.cache.rep_weights.representation_add (transaction, block_a.representative_field ().value (), 0 - amount);
+		auto info = ledger.any.account_get (transaction, destination_account);
+		debug_assert (info);
 		nano::account_info new_info;
-		ledger.update_account (transaction, destination_account, new_info, new_info);
+		ledger.update_account (transaction, destination_account, *info, new_info);
 		ledger.store.block.del (transaction, hash);
 		ledger.store.pending.put (transaction, nano::pending_key (destination_account, block_a.hashables.source), { source_account.value_or (0), amount, nano::epoch::epoch_0 });
 		ledger.stats.inc (nano::stat::type::rollback, nano::stat::detail::open);
@@ -185,7 +192,7 @@ public:
 class ledger_processor : public nano::mutable_block_visitor
 {
 public:
-	ledger_processor (nano::ledger &, nano::secure::write_transaction const &);
+	ledger_processor (nano::ledger &, nano::secure::write_transaction const &, nano::block_verification const &);
 	virtual ~ledger_processor () = default;
 	void send_block (nano::send_block &) override;
 	void receive_block (nano::receive_block &) override;
@@ -196,12 +203,35 @@ public:
 	void epoch_block_impl (nano::state_block &);
 	nano::ledger & ledger;
 	nano::secure::write_transaction const & transaction;
+	nano::block_verification const & verification;
 	nano::block_status result;
 
 private:
 	bool validate_epoch_block (nano::state_block const & block_a);
+	// Returns true if the block signature is not valid for the signer, reuses pre-verified results when available
+	bool signature_invalid (nano::block const & block_a, nano::account const & signer_a) const;
+	// Returns the block work difficulty, reuses the pre-computed value when available
+	uint64_t difficulty (nano::block const & block_a) const;
 };
 
+bool ledger_processor::signature_invalid (nano::block const & block_a, nano::account const & signer_a) const
+{
+	if (auto valid = verification.signature_valid (signer_a))
+	{
+		return !*valid;
+	}
+	return validate_message (signer_a, block_a.hash (), block_a.block_signature ());
+}
+
+uint64_t ledger_processor::difficulty (nano::block const & block_a) const
+{
+	if (verification.difficulty)
+	{
+		return *verification.difficulty;
+	}
+	return ledger.constants.work.difficulty (block_a);
+}
+
 // Returns true if this block which has an epoch link is correctly formed.
 bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 {
@@ -217,10 +247,10 @@ bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 		else
 		{
 			// Check for possible regular state blocks with epoch link (send subtype)
-			if (validate_message (block_a.hashables.account, block_a.hash (), block_a.signature))
+			if (signature_invalid (block_a, block_a.hashables.account))
 			{
 				// Is epoch block signed correctly
-				if (validate_message (ledger.epoch_signer (block_a.link_field ().value ()), block_a.hash (), block_a.signature))
+				if (signature_invalid (block_a, ledger.epoch_signer (block_a.link_field ().value ())))
 				{
 					result = nano::block_status::bad_signature;
 				}
@@ -260,7 +290,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = signature_invalid (block_a, block_a.hashables.account) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -331,7 +361,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 				if (result == nano::block_status::progress)
 				{
 					nano::block_details block_details (epoch, is_send, is_receive, false);
-					result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+					result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						ledger.stats.inc (nano::stat::type::ledger, nano::stat::detail::state_block);
@@ -376,7 +406,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = signature_invalid (block_a, ledger.epoch_signer (block_a.hashables.link)) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature));
@@ -420,7 +450,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 						if (result == nano::block_status::progress)
 						{
 							nano::block_details block_details (epoch, false, false, true);
-							result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+							result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 							if (result == nano::block_status::progress)
 							{
 								ledger.stats.inc (nano::stat::type::ledger, nano::stat::detail::epoch_block);
@@ -458,11 +488,11 @@ void ledger_processor::change_block (nano::change_block & block_a)
 				if (result == nano::block_status::progress)
 				{
 					debug_assert (info->head == block_a.hashables.previous);
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = signature_invalid (block_a, account) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-						result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+						result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 						if (result == nano::block_status::progress)
 						{
 							debug_assert (!validate_message (account, hash, block_a.signature));
@@ -501,11 +531,11 @@ void ledger_processor::send_block (nano::send_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress;
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = signature_invalid (block_a, account) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-						result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+						result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 						if (result == nano::block_status::progress)
 						{
 							debug_assert (!validate_message (account, hash, block_a.signature));
@@ -550,7 +580,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress; // If we have the block but it's not the latest we have a signed fork (Malicious)
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+					result = signature_invalid (block_a, account) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						debug_assert (!validate_message (account, hash, block_a.signature));
@@ -569,7 +599,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 									if (result == nano::block_status::progress)
 									{
 										nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-										result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+										result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 										if (result == nano::block_status::progress)
 										{
 											auto new_balance (info->balance.number () + pending.value ().amount.number ());
@@ -599,7 +629,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block already? (Harmless)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+		result = signature_invalid (block_a, block_a.hashables.account) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -622,7 +652,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 							if (result == nano::block_status::progress)
 							{
 								nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
-								result = ledger.constants.work.difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
+								result = difficulty (block_a) >= ledger.constants.work.threshold (block_a.work_version (), block_details) ? nano::block_status::progress : nano::block_status::insufficient_work; // Does this block have sufficient work? (Malformed)
 								if (result == nano::block_status::progress)
 								{
 									ledger.store.pending.del (transaction, key);
@@ -642,9 +672,10 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	}
 }
 
-ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a) :
+ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a, nano::block_verification const & verification_a) :
 	ledger (ledger_a),
-	transaction (transaction_a)
+	transaction (transaction_a),
+	verification (verification_a)
 {
 }
 
@@ -712,11 +743,13 @@ void representative_visitor::state_block (nano::state_block const & block_a)
 }
 } // namespace
 
-nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a) :
+nano::ledger::ledger (nano::store::component & store_a, nano::stats & stat_a, nano::ledger_constants & constants, nano::generate_cache_flags const & generate_cache_flags_a, nano::uint128_t min_rep_weight_a, nano::block_cache_config const & block_cache_config_a) :
 	constants{ constants },
 	store{ store_a },
 	cache{ store_a.rep_weight, min_rep_weight_a },
 	stats{ stat_a },
+	block_cache{ block_cache_config_a, stat_a },
+	write_group{ *this, stat_a },
 	check_bootstrap_weights{ true },
 	any_impl{ std::make_unique<ledger_set_any> (*this) },
 	confirmed_impl{ std::make_unique<ledger_set_confirmed> (*this) },
@@ -737,6 +770,11 @@ auto nano::ledger::tx_begin_write (nano::store::writer guard_type) const -> secu
 {
 	auto guard = store.write_queue.wait (guard_type);
 	auto txn = store.tx_begin_write ();
+	// Any ledger modification makes a persisted cache snapshot stale, delete it atomically with the first one
+	if (cache_snapshot_stored.exchange (false))
+	{
+		store.version.cache_snapshot_del (txn);
+	}
 	return secure::write_transaction{ std::move (txn), std::move (guard) };
 }
 
@@ -747,6 +785,12 @@ auto nano::ledger::tx_begin_read () const -> secure::read_transaction
 
 void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache_flags_a)
 {
+	cache_complete = generate_cache_flags_a.reps && generate_cache_flags_a.account_count && generate_cache_flags_a.block_count && generate_cache_flags_a.cemented_count;
+	if (cache_complete && !cache_snapshot_load ())
+	{
+		return;
+	}
+
 	if (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count)
 	{
 		store.account.for_each_par (
@@ -765,12 +809,12 @@ void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache
 
 		store.rep_weight.for_each_par (
 		[this] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			nano::rep_weights rep_weights_l{ this->store.rep_weight };
+			nano::rep_weights::builder rep_weights_l;
 			for (; i != n; ++i)
 			{
-				rep_weights_l.representation_put (i->first, i->second.number ());
+				rep_weights_l.add (i->first, i->second.number ());
 			}
-			this->cache.rep_weights.copy_from (rep_weights_l);
+			this->cache.rep_weights.add (rep_weights_l);
 		});
 	}
 
@@ -861,19 +905,15 @@ std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm (secure::write_tr
 			// Unconfirmed dependencies were added
 		}
 
-		// Refresh the transaction to avoid long-running transactions
-		// Ensure that the block wasn't rolled back during the refresh
-		bool refreshed = transaction.refresh_if_needed ();
-		if (refreshed)
+		// Early return might leave parts of the dependency tree unconfirmed
+		if (result.size () >= max_blocks)
 		{
-			if (!any.block_exists (transaction, target_hash))
-			{
-				break; // Block was rolled back during cementing
-			}
+			break;
 		}
 
-		// Early return might leave parts of the dependency tree unconfirmed
-		if (result.size () >= max_blocks)
+		// Return early to avoid long-running transactions, the caller continues in a new one
+		// The transaction might be shared by a write group and must not be refreshed here
+		if (std::chrono::steady_clock::now () - transaction.timestamp () > nano::write_group::max_transaction_age)
 		{
 			break;
 		}
@@ -892,18 +932,41 @@ void nano::ledger::confirm_one (secure::write_transaction & transaction, nano::b
 	stats.inc (nano::stat::type::confirmation_height, nano::stat::detail::blocks_confirmed);
 }
 
-nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a)
+nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a, nano::block_verification const & verification_a)
 {
 	debug_assert (!constants.work.validate_entry (*block_a) || constants.genesis == nano::dev::genesis);
-	ledger_processor processor (*this, transaction_a);
+	ledger_processor processor (*this, transaction_a, verification_a);
 	block_a->visit (processor);
 	if (processor.result == nano::block_status::progress)
 	{
 		++cache.block_count;
+		store.height.put (transaction_a, block_a->account (), block_a->sideband ().height, block_a->hash ());
+		// Storing the block updated the successor of its predecessor
+		cache_erase (transaction_a, block_a->previous ());
+		cache_put (transaction_a, block_a);
 	}
 	return processor.result;
 }
 
+void nano::ledger::cache_put (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> const & block_a)
+{
+	// Blocks received from the network keep their serialized form for relaying, cache a copy without it so the cache does not pin those bytes
+	auto cached = block_a->wire_bytes () ? block_a->clone () : block_a;
+	// Transactions started before the commit must not be served the block
+	transaction_a.on_commit ([this, cached = std::move (cached)] () {
+		block_cache.put (cached);
+	});
+}
+
+void nano::ledger::cache_erase (secure::write_transaction const & transaction_a, nano::block_hash const & hash_a)
+{
+	block_cache.erase (hash_a);
+	// Blocks written earlier in this transaction are only cached on commit, erasing again keeps the latest change
+	transaction_a.on_commit ([this, hash_a] () {
+		block_cache.erase (hash_a);
+	});
+}
+
 nano::block_hash nano::ledger::representative (secure::transaction const & transaction_a, nano::block_hash const & hash_a)
 {
 	auto result (representative_calculated (transaction_a, hash_a));
@@ -1008,11 +1071,15 @@ bool nano::ledger::rollback (secure::write_transaction const & transaction_a, na
 			debug_assert (info);
 			auto block_l = any.block_get (transaction_a, info->head);
 			list_a.push_back (block_l);
+			// Rolling back deletes the block and clears the successor of its predecessor
+			cache_erase (transaction_a, block_l->hash ());
+			cache_erase (transaction_a, block_l->previous ());
 			block_l->visit (rollback);
 			error = rollback.error;
 			if (!error)
 			{
 				--cache.block_count;
+				store.height.del (transaction_a, account_l, block_l->sideband ().height);
 			}
 		}
 		else
@@ -1196,11 +1263,20 @@ void nano::ledger::update_account (secure::write_transaction const & transaction
 			store.account.del (transaction_a, account_a);
 		}
 		store.account.put (transaction_a, account_a, new_a);
+		if (old_a.head.is_zero () || old_a.representative != new_a.representative)
+		{
+			if (!old_a.head.is_zero ())
+			{
+				store.delegator.del (transaction_a, old_a.representative, account_a);
+			}
+			store.delegator.put (transaction_a, new_a.representative, account_a);
+		}
 	}
 	else
 	{
 		debug_assert (!store.confirmation_height.exists (transaction_a, account_a));
 		store.account.del (transaction_a, account_a);
+		store.delegator.del (transaction_a, old_a.representative, account_a);
 		debug_assert (cache.account_count > 0);
 		--cache.account_count;
 	}
@@ -1238,6 +1314,8 @@ uint64_t nano::ledger::pruning_action (secure::write_transaction & transaction_a
 		{
 			release_assert (confirmed.block_exists (transaction_a, hash));
 			store.block.del (transaction_a, hash);
+			store.height.del (transaction_a, block_l->account (), block_l->sideband ().height);
+			cache_erase (transaction_a, hash);
 			store.pruned.put (transaction_a, hash);
 			hash = block_l->previous ();
 			++pruned_count;
@@ -1280,170 +1358,41 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 	boost::system::error_code error_chmod;
 	nano::set_secure_perm_directory (data_path_a, error_chmod);
 	auto rockdb_data_path = data_path_a / "rocksdb";
+	auto migration_path = data_path_a / "rocksdb_migration";
 
-	if (std::filesystem::exists (rockdb_data_path))
+	if (std::filesystem::exists (rockdb_data_path) && !std::filesystem::exists (migration_path))
 	{
 		logger.error (nano::log::type::ledger, "Existing RocksDb folder found in '{}'. Please remove it and try again.", rockdb_data_path.string ());
 		return true;
 	}
 
+	auto * lmdb_store = dynamic_cast<nano::store::lmdb::component *> (&store);
+	if (lmdb_store == nullptr)
+	{
+		logger.error (nano::log::type::ledger, "The ledger is not an LMDB database");
+		return true;
+	}
+
 	auto error (false);
 
 	// Open rocksdb database
 	nano::rocksdb_config rocksdb_config;
 	rocksdb_config.enable = true;
-	auto rocksdb_store = nano::make_store (logger, data_path_a, nano::dev::constants, false, true, rocksdb_config);
+	auto rocksdb_store = std::make_unique<nano::store::rocksdb::component> (logger, rockdb_data_path, constants, rocksdb_config);
 
 	if (!rocksdb_store->init_error ())
 	{
-		auto table_size = store.count (store.tx_begin_read (), tables::blocks);
-		logger.info (nano::log::type::ledger, "Step 1 of 7: Converting {} entries from blocks table", table_size);
-		std::atomic<std::size_t> count = 0;
-		store.block.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				std::vector<uint8_t> vector;
-				{
-					nano::vectorstream stream (vector);
-					nano::serialize_block (stream, *i->second.block);
-					i->second.sideband.serialize (stream, i->second.block->type ());
-				}
-				rocksdb_store->block.raw_put (rocksdb_transaction, vector, i->first);
-
-				if (auto count_l = ++count; count_l % 5000000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} blocks converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::pending);
-		logger.info (nano::log::type::ledger, "Step 2 of 7: Converting {} entries from pending table", table_size);
-		count = 0;
-		store.pending.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->pending.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::confirmation_height);
-		logger.info (nano::log::type::ledger, "Step 3 of 7: Converting {} entries from confirmation_height table", table_size);
-		count = 0;
-		store.confirmation_height.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->confirmation_height.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::accounts);
-		logger.info (nano::log::type::ledger, "Step 4 of 7: Converting {} entries from accounts table", table_size);
-		count = 0;
-		store.account.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->account.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::rep_weights);
-		logger.info (nano::log::type::ledger, "Step 5 of 7: Converting {} entries from rep_weights table", table_size);
-		count = 0;
-		store.rep_weight.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->rep_weight.put (rocksdb_transaction, i->first, i->second.number ());
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::pruned);
-		logger.info (nano::log::type::ledger, "Step 6 of 7: Converting {} entries from pruned table", table_size);
-		count = 0;
-		store.pruned.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->pruned.put (rocksdb_transaction, i->first);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		table_size = store.count (store.tx_begin_read (), tables::final_votes);
-		logger.info (nano::log::type::ledger, "Step 7 of 7: Converting {} entries from final_votes table", table_size);
-		count = 0;
-		store.final_vote.for_each_par (
-		[&] (store::read_transaction const & /*unused*/, auto i, auto n) {
-			auto rocksdb_transaction = rocksdb_store->tx_begin_write ();
-			for (; i != n; ++i)
-			{
-				rocksdb_transaction.refresh_if_needed ();
-				rocksdb_store->final_vote.put (rocksdb_transaction, i->first, i->second);
-				if (auto count_l = ++count; count_l % 500000 == 0)
-				{
-					logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count_l, count_l * 100 / table_size);
-				}
-			}
-		});
-		logger.info (nano::log::type::ledger, "{} entries converted ({}%)", count.load (), table_size > 0 ? count.load () * 100 / table_size : 100);
-
-		logger.info (nano::log::type::ledger, "Finalizing migration...");
-		auto lmdb_transaction (store.tx_begin_read ());
-		auto version = store.version.get (lmdb_transaction);
-		auto rocksdb_transaction (rocksdb_store->tx_begin_write ());
-		rocksdb_store->version.put (rocksdb_transaction, version);
-
-		for (auto i (store.online_weight.begin (lmdb_transaction)), n (store.online_weight.end (lmdb_transaction)); i != n; ++i)
+		// Interrupted migrations leave their checkpoint in the migration folder and continue where they stopped
+		nano::store::rocksdb::lmdb_import import{ *lmdb_store, *rocksdb_store, migration_path, logger };
+		if (import.run ())
 		{
-			rocksdb_store->online_weight.put (rocksdb_transaction, i->first, i->second);
+			logger.error (nano::log::type::ledger, "Migration failed, run it again to resume");
+			return true;
 		}
 
-		for (auto i (store.peer.begin (lmdb_transaction)), n (store.peer.end (lmdb_transaction)); i != n; ++i)
-		{
-			rocksdb_store->peer.put (rocksdb_transaction, i->first, i->second);
-		}
+		logger.info (nano::log::type::ledger, "Finalizing migration...");
+		auto lmdb_transaction (store.tx_begin_read ());
+		auto rocksdb_transaction (rocksdb_store->tx_begin_read ());
 
 		// Compare counts
 		error |= store.peer.count (lmdb_transaction) != rocksdb_store->peer.count (rocksdb_transaction);
@@ -1451,11 +1400,13 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (std::filesystem::path const & data_p
 		error |= store.final_vote.count (lmdb_transaction) != rocksdb_store->final_vote.count (rocksdb_transaction);
 		error |= store.online_weight.count (lmdb_transaction) != rocksdb_store->online_weight.count (rocksdb_transaction);
 		error |= store.rep_weight.count (lmdb_transaction) != rocksdb_store->rep_weight.count (rocksdb_transaction);
+		error |= store.delegator.count (lmdb_transaction) != rocksdb_store->delegator.count (rocksdb_transaction);
 		error |= store.version.get (lmdb_transaction) != rocksdb_store->version.get (rocksdb_transaction);
 
 		// For large tables a random key is used instead and makes sure it exists
 		auto random_block (store.block.random (lmdb_transaction));
 		error |= rocksdb_store->block.get (rocksdb_transaction, random_block->hash ()) == nullptr;
+		error |= rocksdb_store->height.get (rocksdb_transaction, random_block->account (), random_block->sideband ().height) != random_block->hash ();
 
 		auto account = random_block->account ();
 		nano::account_info account_info;
@@ -1523,10 +1474,139 @@ uint64_t nano::ledger::pruned_count () const
 	return cache.pruned_count;
 }
 
+namespace
+{
+uint8_t constexpr cache_snapshot_format = 1;
+
+nano::block_hash cache_snapshot_checksum (uint8_t const * data_a, std::size_t size_a)
+{
+	nano::block_hash result;
+	blake2b_state hash;
+	blake2b_init (&hash, sizeof (result.bytes));
+	blake2b_update (&hash, data_a, size_a);
+	blake2b_final (&hash, result.bytes.data (), sizeof (result.bytes));
+	return result;
+}
+}
+
+/*
+ * Snapshot layout: format, minimum cached rep weight, block, cemented, account and pruned counts,
+ * number of representatives followed by (representative, weight) pairs, and a blake2b checksum of everything before it
+ */
+std::vector<uint8_t> nano::ledger::cache_snapshot_serialize () const
+{
+	auto const rep_amounts = cache.rep_weights.get_rep_amounts ();
+	std::vector<uint8_t> result;
+	{
+		nano::vectorstream stream (result);
+		nano::write (stream, cache_snapshot_format);
+		nano::write (stream, nano::uint128_union{ cache.rep_weights.min_weight_get () });
+		nano::write (stream, cache.block_count.load ());
+		nano::write (stream, cache.cemented_count.load ());
+		nano::write (stream, cache.account_count.load ());
+		nano::write (stream, cache.pruned_count.load ());
+		nano::write (stream, static_cast<uint64_t> (rep_amounts.size ()));
+		for (auto const & [representative, weight] : rep_amounts)
+		{
+			nano::write (stream, representative);
+			nano::write (stream, nano::uint128_union{ weight });
+		}
+	}
+	auto const checksum = cache_snapshot_checksum (result.data (), result.size ());
+	result.insert (result.end (), checksum.bytes.begin (), checksum.bytes.end ());
+	return result;
+}
+
+bool nano::ledger::cache_snapshot_load ()
+{
+	auto const snapshot = store.version.cache_snapshot_get (store.tx_begin_read ());
+	if (!snapshot)
+	{
+		return true;
+	}
+	bool error = snapshot->size () < sizeof (nano::block_hash);
+	auto const payload_size = error ? 0 : snapshot->size () - sizeof (nano::block_hash);
+	if (!error)
+	{
+		nano::block_hash checksum;
+		std::copy (snapshot->begin () + payload_size, snapshot->end (), checksum.bytes.begin ());
+		error = checksum != cache_snapshot_checksum (snapshot->data (), payload_size);
+	}
+	if (!error)
+	{
+		try
+		{
+			nano::bufferstream stream (snapshot->data (), payload_size);
+			uint8_t format;
+			nano::uint128_union min_weight;
+			uint64_t block_count_l, cemented_count_l, account_count_l, pruned_count_l, rep_count;
+			nano::read (stream, format);
+			nano::read (stream, min_weight);
+			nano::read (stream, block_count_l);
+			nano::read (stream, cemented_count_l);
+			nano::read (stream, account_count_l);
+			nano::read (stream, pruned_count_l);
+			nano::read (stream, rep_count);
+			// Weights cached with a different minimum cannot be reused
+			error |= format != cache_snapshot_format || min_weight.number () != cache.rep_weights.min_weight_get ();
+			if (!error)
+			{
+				nano::rep_weights::builder rep_weights_l;
+				for (uint64_t i = 0; i < rep_count; ++i)
+				{
+					nano::account representative;
+					nano::uint128_union weight;
+					nano::read (stream, representative);
+					nano::read (stream, weight);
+					rep_weights_l.add (representative, weight.number ());
+				}
+				error = !nano::at_end (stream);
+				if (!error)
+				{
+					cache.rep_weights.add (rep_weights_l);
+					cache.block_count = block_count_l;
+					cache.cemented_count = cemented_count_l;
+					cache.account_count = account_count_l;
+					cache.pruned_count = pruned_count_l;
+				}
+			}
+		}
+		catch (std::runtime_error const &)
+		{
+			error = true;
+		}
+	}
+	stats.inc (nano::stat::type::ledger, error ? nano::stat::detail::cache_snapshot_invalid : nano::stat::detail::cache_snapshot_loaded);
+	// The snapshot is deleted by the next ledger write, until then it remains valid for another startup
+	cache_snapshot_stored = true;
+	return error;
+}
+
+void nano::ledger::cache_snapshot_write ()
+{
+	if (!cache_complete)
+	{
+		return;
+	}
+	auto transaction = tx_begin_write ();
+	// Holding the write transaction ensures no ledger modification is in progress while the cache is copied
+	store.version.cache_snapshot_put (transaction, cache_snapshot_serialize ());
+	cache_snapshot_stored = true;
+	stats.inc (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_written);
+}
+
+void nano::ledger::cache_snapshot_discard ()
+{
+	auto transaction = tx_begin_write ();
+	store.version.cache_snapshot_del (transaction);
+	cache_snapshot_stored = false;
+}
+
 nano::container_info nano::ledger::container_info () const
 {
 	nano::container_info info;
 	info.put ("bootstrap_weights", bootstrap_weights);
 	info.add ("rep_weights", cache.rep_weights.container_info ());
+	info.add ("block_cache", block_cache.container_info ());
 	return info;
 }
@@ -3,10 +3,13 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/secure/account_info.hpp>
+#include <nano/secure/block_cache.hpp>
+#include <nano/secure/block_verification.hpp>
 #include <nano/secure/generate_cache_flags.hpp>
 #include <nano/secure/ledger_cache.hpp>
 #include <nano/secure/pending_info.hpp>
 #include <nano/secure/transaction.hpp>
+#include <nano/secure/write_group.hpp>
 
 #include <deque>
 #include <map>
@@ -35,7 +38,7 @@ class ledger final
 	friend class receivable_iterator;
 
 public:
-	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0);
+	ledger (nano::store::component &, nano::stats &, nano::ledger_constants & constants, nano::generate_cache_flags const & = nano::generate_cache_flags{}, nano::uint128_t min_rep_weight_a = 0, nano::block_cache_config const & = nano::block_cache_config{});
 	~ledger ();
 
 	/** Start read-write transaction */
@@ -61,7 +64,8 @@ public:
 	std::pair<nano::block_hash, nano::block_hash> hash_root_random (secure::transaction const &) const;
 	std::optional<nano::pending_info> pending_info (secure::transaction const &, nano::pending_key const & key) const;
 	std::deque<std::shared_ptr<nano::block>> confirm (secure::write_transaction &, nano::block_hash const & hash, size_t max_blocks = 1024 * 128);
-	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block);
+	/** Process block, stateless checks already present in \p verification are not repeated */
+	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block, nano::block_verification const & verification = {});
 	bool rollback (secure::write_transaction const &, nano::block_hash const &, std::vector<std::shared_ptr<nano::block>> &);
 	bool rollback (secure::write_transaction const &, nano::block_hash const &);
 	void update_account (secure::write_transaction const &, nano::account const &, nano::account_info const &, nano::account_info const &);
@@ -81,6 +85,14 @@ public:
 	uint64_t block_count () const;
 	uint64_t account_count () const;
 	uint64_t pruned_count () const;
+	/**
+	 * Persists the cached counters and representative weights so the next startup can skip rebuilding them from the tables.
+	 * The snapshot is deleted by the next ledger write transaction, so a snapshot found at startup always matches the ledger.
+	 * Does nothing if the cache was not fully generated.
+	 */
+	void cache_snapshot_write ();
+	/** Deletes the persisted cache snapshot, must be called before modifying ledger tables without going through the ledger */
+	void cache_snapshot_discard ();
 
 	nano::container_info container_info () const;
 
@@ -91,6 +103,8 @@ public:
 	nano::store::component & store;
 	nano::ledger_cache cache;
 	nano::stats & stats;
+	mutable nano::block_cache block_cache;
+	nano::write_group write_group;
 
 	std::unordered_map<nano::account, nano::uint128_t> bootstrap_weights;
 	uint64_t bootstrap_weight_max_blocks{ 1 };
@@ -100,11 +114,22 @@ public:
 
 private:
 	void initialize (nano::generate_cache_flags const &);
+	/** Returns true if the snapshot is missing or invalid, in which case the cache is left untouched */
+	bool cache_snapshot_load ();
+	std::vector<uint8_t> cache_snapshot_serialize () const;
 	void confirm_one (secure::write_transaction &, nano::block const & block);
+	/** Blocks become visible in block_cache once the transaction writing them commits */
+	void cache_put (secure::write_transaction const &, std::shared_ptr<nano::block> const &);
+	void cache_erase (secure::write_transaction const &, nano::block_hash const &);
 
 	std::unique_ptr<ledger_set_any> any_impl;
 	std::unique_ptr<ledger_set_confirmed> confirmed_impl;
 
+	/** Whether all cached values were generated at startup, only then can they be persisted */
+	bool cache_complete{ false };
+	/** Set while a cache snapshot is stored, cleared by the write transaction deleting it */
+	mutable std::atomic<bool> cache_snapshot_stored{ false };
+
 public:
 	ledger_set_any & any;
 	ledger_set_confirmed & confirmed;
@@ -2,6 +2,8 @@
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/store/account.hpp>
 #include <nano/store/component.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/height.hpp>
 #include <nano/store/pending.hpp>
 #include <nano/store/pruned.hpp>
 
@@ -35,6 +37,11 @@ std::optional<nano::account_info> nano::ledger_set_any::account_get (secure::tra
 	return ledger.store.account.get (transaction, account);
 }
 
+std::vector<std::optional<nano::account_info>> nano::ledger_set_any::account_get_multi (secure::transaction const & transaction, std::vector<nano::account> const & accounts) const
+{
+	return ledger.store.account.get_multi (transaction, accounts);
+}
+
 nano::block_hash nano::ledger_set_any::account_head (secure::transaction const & transaction, nano::account const & account) const
 {
 	auto info = account_get (transaction, account);
@@ -137,9 +144,42 @@ bool nano::ledger_set_any::block_exists_or_pruned (secure::transaction const & t
 
 std::shared_ptr<nano::block> nano::ledger_set_any::block_get (secure::transaction const & transaction, nano::block_hash const & hash) const
 {
+	if (auto block = ledger.block_cache.get (hash))
+	{
+		return block;
+	}
 	return ledger.store.block.get (transaction, hash);
 }
 
+std::vector<std::shared_ptr<nano::block>> nano::ledger_set_any::block_get_multi (secure::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const
+{
+	std::vector<std::shared_ptr<nano::block>> result (hashes.size ());
+	// Only blocks missing from the cache are looked up in the store
+	std::vector<nano::block_hash> missing;
+	std::vector<std::size_t> missing_index;
+	for (std::size_t i = 0; i < hashes.size (); ++i)
+	{
+		if (auto block = ledger.block_cache.get (hashes[i]))
+		{
+			result[i] = block;
+		}
+		else
+		{
+			missing.push_back (hashes[i]);
+			missing_index.push_back (i);
+		}
+	}
+	if (!missing.empty ())
+	{
+		auto blocks = ledger.store.block.get_multi (transaction, missing);
+		for (std::size_t i = 0; i < blocks.size (); ++i)
+		{
+			result[missing_index[i]] = blocks[i];
+		}
+	}
+	return result;
+}
+
 uint64_t nano::ledger_set_any::block_height (secure::transaction const & transaction, nano::block_hash const & hash) const
 {
 	auto block = block_get (transaction, hash);
@@ -150,6 +190,55 @@ uint64_t nano::ledger_set_any::block_height (secure::transaction const & transac
 	return block->sideband ().height;
 }
 
+std::optional<nano::block_hash> nano::ledger_set_any::block_hash_at_height (secure::transaction const & transaction, nano::account const & account, uint64_t height) const
+{
+	return ledger.store.height.get (transaction, account, height);
+}
+
+auto nano::ledger_set_any::delegator_begin (secure::transaction const & transaction, nano::account const & representative) const -> delegator_iterator
+{
+	auto result = delegator_lower_bound (transaction, representative, 0);
+	if (!result || result.value ().first.representative != representative)
+	{
+		return delegator_iterator{ transaction, *this, std::nullopt };
+	}
+	return delegator_iterator{ transaction, *this, result };
+}
+
+auto nano::ledger_set_any::delegator_end () const -> delegator_iterator
+{
+	return delegator_iterator{};
+}
+
+std::optional<std::pair<nano::delegator_key, nano::account_info>> nano::ledger_set_any::delegator_lower_bound (secure::transaction const & transaction, nano::account const & representative, nano::account const & account) const
+{
+	auto result = ledger.store.delegator.begin (transaction, { representative, account });
+	if (result == ledger.store.delegator.end (transaction))
+	{
+		return std::nullopt;
+	}
+	auto const & key = result->first;
+	auto info = ledger.store.account.get (transaction, key.account);
+	// The delegators table is updated together with the accounts table
+	release_assert (info);
+	return std::make_pair (key, info.value ());
+}
+
+auto nano::ledger_set_any::delegator_upper_bound (secure::transaction const & transaction, nano::account const & representative, nano::account const & account) const -> delegator_iterator
+{
+	auto next = account.number () + 1;
+	if (next == 0)
+	{
+		return delegator_iterator{ transaction, *this, std::nullopt };
+	}
+	auto result = delegator_lower_bound (transaction, representative, next);
+	if (!result || result.value ().first.representative != representative)
+	{
+		return delegator_iterator{ transaction, *this, std::nullopt };
+	}
+	return delegator_iterator{ transaction, *this, result };
+}
+
 std::optional<std::pair<nano::pending_key, nano::pending_info>> nano::ledger_set_any::receivable_lower_bound (secure::transaction const & transaction, nano::account const & account, nano::block_hash const & hash) const
 {
 	auto result = ledger.store.pending.begin (transaction, { account, hash });
@@ -167,8 +256,7 @@ auto nano::ledger_set_any::receivable_end () const -> receivable_iterator
 
 bool nano::ledger_set_any::receivable_exists (secure::transaction const & transaction, nano::account const & account) const
 {
-	auto next = receivable_upper_bound (transaction, account, 0);
-	return next != receivable_end ();
+	return ledger.store.pending.any (transaction, account);
 }
 
 auto nano::ledger_set_any::receivable_upper_bound (secure::transaction const & transaction, nano::account const & account) const -> receivable_iterator
@@ -215,3 +303,8 @@ std::optional<nano::pending_info> nano::ledger_set_any::pending_get (secure::tra
 {
 	return ledger.store.pending.get (transaction, key);
 }
+
+std::vector<std::optional<nano::pending_info>> nano::ledger_set_any::pending_get_multi (secure::transaction const & transaction, std::vector<nano::pending_key> const & keys) const
+{
+	return ledger.store.pending.get_multi (transaction, keys);
+}
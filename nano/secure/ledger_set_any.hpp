@@ -1,15 +1,18 @@
 #pragma once
 
 #include <nano/secure/account_iterator.hpp>
+#include <nano/secure/delegator_iterator.hpp>
 #include <nano/secure/receivable_iterator.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace nano
 {
 class account_info;
 class block;
 class block_hash;
+class delegator_key;
 class ledger;
 class pending_info;
 class pending_key;
@@ -26,6 +29,7 @@ class ledger_set_any
 {
 public:
 	using account_iterator = nano::account_iterator<ledger_set_any>;
+	using delegator_iterator = nano::delegator_iterator<ledger_set_any>;
 	using receivable_iterator = nano::receivable_iterator<ledger_set_any>;
 
 	ledger_set_any (nano::ledger const & ledger);
@@ -35,6 +39,8 @@ public: // Operations on accounts
 	account_iterator account_begin (secure::transaction const & transaction) const;
 	account_iterator account_end () const;
 	std::optional<nano::account_info> account_get (secure::transaction const & transaction, nano::account const & account) const;
+	// Batched account_get, entries are in the same order as 'accounts'
+	std::vector<std::optional<nano::account_info>> account_get_multi (secure::transaction const & transaction, std::vector<nano::account> const & accounts) const;
 	nano::block_hash account_head (secure::transaction const & transaction, nano::account const & account) const;
 	uint64_t account_height (secure::transaction const & transaction, nano::account const & account) const;
 	// Returns the next account entry equal or greater than 'account'
@@ -53,12 +59,29 @@ public: // Operations on blocks
 	bool block_exists (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	bool block_exists_or_pruned (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	std::shared_ptr<nano::block> block_get (secure::transaction const & transaction, nano::block_hash const & hash) const;
+	// Batched block_get, entries are in the same order as 'hashes' and null for blocks not found
+	std::vector<std::shared_ptr<nano::block>> block_get_multi (secure::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const;
 	uint64_t block_height (secure::transaction const & transaction, nano::block_hash const & hash) const;
+	// Returns the hash of the block at 'height' in the chain of 'account', heights start at 1 with the open block
+	std::optional<nano::block_hash> block_hash_at_height (secure::transaction const & transaction, nano::account const & account, uint64_t height) const;
 	std::optional<nano::block_hash> block_successor (secure::transaction const & transaction, nano::block_hash const & hash) const;
 	std::optional<nano::block_hash> block_successor (secure::transaction const & transaction, nano::qualified_root const & root) const;
 
+public: // Operations on delegators
+	// Returns the first account delegating to 'representative'
+	delegator_iterator delegator_begin (secure::transaction const & transaction, nano::account const & representative) const;
+	delegator_iterator delegator_end () const;
+	// Returns the next delegator entry equal or greater than (representative, account)
+	// Mirrors std::map::lower_bound
+	std::optional<std::pair<nano::delegator_key, nano::account_info>> delegator_lower_bound (secure::transaction const & transaction, nano::account const & representative, nano::account const & account) const;
+	// Returns the next account delegating to 'representative' greater than 'account'
+	// Mirrors std::map::upper_bound
+	delegator_iterator delegator_upper_bound (secure::transaction const & transaction, nano::account const & representative, nano::account const & account) const;
+
 public: // Operations on pending entries
 	std::optional<nano::pending_info> pending_get (secure::transaction const & transaction, nano::pending_key const & key) const;
+	// Batched pending_get, entries are in the same order as 'keys'
+	std::vector<std::optional<nano::pending_info>> pending_get_multi (secure::transaction const & transaction, std::vector<nano::pending_key> const & keys) const;
 	receivable_iterator receivable_end () const;
 	bool receivable_exists (secure::transaction const & transaction, nano::account const & account) const;
 	// Returns the next receivable entry equal or greater than 'key'
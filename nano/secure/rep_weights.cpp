@@ -4,9 +4,11 @@
 #include <nano/store/rep_weight.hpp>
 
 nano::rep_weights::rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a) :
+	current{ std::make_shared<snapshot> () },
 	rep_weight_store{ rep_weight_store_a },
 	min_weight{ min_weight_a }
 {
+	current.latest ().base = std::make_shared<table const> ();
 }
 
 void nano::rep_weights::representation_add (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & amount_a)
@@ -14,8 +16,8 @@ void nano::rep_weights::representation_add (store::write_transaction const & txn
 	auto previous_weight{ rep_weight_store.get (txn_a, rep_a) };
 	auto new_weight = previous_weight + amount_a;
 	put_store (txn_a, rep_a, previous_weight, new_weight);
-	std::unique_lock guard{ mutex };
-	put_cache (rep_a, new_weight);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	put_cache ({ { rep_a, new_weight } });
 }
 
 void nano::rep_weights::representation_add_dual (store::write_transaction const & txn_a, nano::account const & rep_1, nano::uint128_t const & amount_1, nano::account const & rep_2, nano::uint128_t const & amount_2)
@@ -28,9 +30,8 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 		auto new_weight_2 = previous_weight_2 + amount_2;
 		put_store (txn_a, rep_1, previous_weight_1, new_weight_1);
 		put_store (txn_a, rep_2, previous_weight_2, new_weight_2);
-		std::unique_lock guard{ mutex };
-		put_cache (rep_1, new_weight_1);
-		put_cache (rep_2, new_weight_2);
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		put_cache ({ { rep_1, new_weight_1 }, { rep_2, new_weight_2 } });
 	}
 	else
 	{
@@ -40,56 +41,84 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 
 void nano::rep_weights::representation_put (nano::account const & account_a, nano::uint128_t const & representation_a)
 {
-	std::unique_lock guard{ mutex };
-	put_cache (account_a, representation_a);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	put_cache ({ { account_a, representation_a } });
 }
 
 nano::uint128_t nano::rep_weights::representation_get (nano::account const & account_a) const
 {
-	std::shared_lock lk{ mutex };
-	return get (account_a);
+	return current.get ()->get (account_a);
 }
 
 /** Makes a copy */
 std::unordered_map<nano::account, nano::uint128_t> nano::rep_weights::get_rep_amounts () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts;
+	auto const snapshot_l = current.get ();
+	std::unordered_map<nano::account, nano::uint128_t> result;
+	result.reserve (snapshot_l->size);
+	snapshot_l->for_each ([&result] (nano::account const & account, nano::uint128_t const & amount) {
+		result.emplace (account, amount);
+	});
+	return result;
 }
 
-void nano::rep_weights::copy_from (nano::rep_weights & other_a)
+void nano::rep_weights::add (builder const & builder_a)
 {
-	std::unique_lock guard_this{ mutex };
-	std::shared_lock guard_other{ other_a.mutex };
-	for (auto const & entry : other_a.rep_amounts)
-	{
-		auto prev_amount (get (entry.first));
-		put_cache (entry.first, prev_amount + entry.second);
-	}
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	auto const & this_l = current.latest ();
+	changes_t changes;
+	changes.reserve (builder_a.weights->size ());
+	builder_a.weights->for_each ([&] (nano::account const & account, nano::uint128_t const & amount) {
+		changes.emplace_back (account, this_l.get (account) + amount);
+	});
+	put_cache (changes);
 }
 
-void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_union const & representation_a)
+void nano::rep_weights::put_cache (changes_t const & changes_a)
 {
-	auto it = rep_amounts.find (account_a);
-	if (representation_a < min_weight || representation_a.is_zero ())
+	debug_assert (!mutex.try_lock ());
+	// Only writers publish, holding `mutex` is enough to read the latest snapshot
+	auto const & previous = current.latest ();
+
+	// Latest weight of every representative changed since the base was built
+	table changed = previous.delta;
+	auto size = previous.size;
+	for (auto const & [account, amount] : changes_a)
 	{
-		if (it != rep_amounts.end ())
-		{
-			rep_amounts.erase (it);
-		}
+		auto const * existing = changed.find (account);
+		existing = existing != nullptr ? existing : previous.base->find (account);
+		auto const old_amount = existing != nullptr ? *existing : nano::uint128_t{ 0 };
+		auto const new_amount = amount < min_weight ? nano::uint128_t{ 0 } : amount;
+		size = size - (old_amount != 0) + (new_amount != 0);
+		changed.put (account, new_amount);
+	}
+
+	auto next = std::make_shared<snapshot> ();
+	next->size = size;
+	if (changed.size () <= delta_max)
+	{
+		next->base = previous.base;
+		next->delta = std::move (changed);
 	}
 	else
 	{
-		auto amount = representation_a.number ();
-		if (it != rep_amounts.end ())
-		{
-			it->second = amount;
-		}
-		else
-		{
-			rep_amounts.emplace (account_a, amount);
-		}
+		auto base = std::make_shared<table> ();
+		previous.base->for_each ([&] (nano::account const & account, nano::uint128_t const & amount) {
+			if (changed.find (account) == nullptr)
+			{
+				base->put (account, amount);
+			}
+		});
+		changed.for_each ([&] (nano::account const & account, nano::uint128_t const & amount) {
+			if (amount != 0)
+			{
+				base->put (account, amount);
+			}
+		});
+		next->base = std::move (base);
 	}
+
+	current.publish (std::move (next));
 }
 
 void nano::rep_weights::put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a)
@@ -107,30 +136,119 @@ void nano::rep_weights::put_store (store::write_transaction const & txn_a, nano:
 	}
 }
 
-nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
+std::size_t nano::rep_weights::size () const
+{
+	return current.get ()->size;
+}
+
+nano::uint128_t nano::rep_weights::min_weight_get () const
+{
+	return min_weight;
+}
+
+nano::container_info nano::rep_weights::container_info () const
+{
+	auto const snapshot_l = current.get ();
+
+	nano::container_info info;
+	info.put ("rep_amounts", snapshot_l->size, sizeof (nano::account) + sizeof (nano::uint128_t));
+	info.put ("delta", snapshot_l->delta.size (), sizeof (nano::account) + sizeof (nano::uint128_t));
+	return info;
+}
+
+/*
+ * builder
+ */
+
+nano::rep_weights::builder::builder () :
+	weights{ std::make_unique<table> () }
+{
+}
+
+nano::rep_weights::builder::~builder () = default;
+
+void nano::rep_weights::builder::add (nano::account const & account_a, nano::uint128_t const & amount_a)
+{
+	auto const * existing = weights->find (account_a);
+	weights->put (account_a, (existing != nullptr ? *existing : nano::uint128_t{ 0 }) + amount_a);
+}
+
+/*
+ * snapshot
+ */
+
+nano::uint128_t nano::rep_weights::snapshot::get (nano::account const & account_a) const
+{
+	if (auto const * amount = delta.find (account_a))
+	{
+		return *amount;
+	}
+	if (auto const * amount = base->find (account_a))
+	{
+		return *amount;
+	}
+	return 0;
+}
+
+/*
+ * table
+ */
+
+nano::uint128_t const * nano::rep_weights::table::find (nano::account const & account_a) const
 {
-	auto it = rep_amounts.find (account_a);
-	if (it != rep_amounts.end ())
+	if (entries.empty ())
 	{
-		return it->second;
+		return nullptr;
 	}
-	else
+	auto const & entry = entries[slot (account_a)];
+	return entry.used ? &entry.amount : nullptr;
+}
+
+void nano::rep_weights::table::put (nano::account const & account_a, nano::uint128_t const & amount_a)
+{
+	// Keep the load factor below one half so probe sequences stay short
+	if ((count + 1) * 2 > entries.size ())
+	{
+		grow ();
+	}
+	auto & entry = entries[slot (account_a)];
+	if (!entry.used)
 	{
-		return nano::uint128_t{ 0 };
+		entry.used = true;
+		entry.account = account_a;
+		++count;
 	}
+	entry.amount = amount_a;
 }
 
-std::size_t nano::rep_weights::size () const
+std::size_t nano::rep_weights::table::size () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts.size ();
+	return count;
 }
 
-nano::container_info nano::rep_weights::container_info () const
+std::size_t nano::rep_weights::table::slot (nano::account const & account_a) const
 {
-	std::shared_lock guard{ mutex };
+	debug_assert (!entries.empty ());
+	auto const mask = entries.size () - 1;
+	// Accounts are public keys and already uniformly distributed
+	auto index = static_cast<std::size_t> (account_a.qwords[0]) & mask;
+	while (entries[index].used && entries[index].account != account_a)
+	{
+		index = (index + 1) & mask;
+	}
+	return index;
+}
 
-	nano::container_info info;
-	info.put ("rep_amounts", rep_amounts);
-	return info;
+void nano::rep_weights::table::grow ()
+{
+	std::vector<entry> previous (std::max<std::size_t> (16, entries.size () * 2));
+	previous.swap (entries);
+	count = 0;
+	for (auto const & entry : previous)
+	{
+		if (entry.used)
+		{
+			put (entry.account, entry.amount);
+		}
+	}
 }
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/numbers_templ.hpp>
 #include <nano/lib/utility.hpp>
+#include <nano/lib/versioned_snapshot.hpp>
 
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace nano
 {
@@ -17,9 +21,31 @@ namespace store
 	class write_transaction;
 }
 
+/**
+ * Cache of representative weights
+ * Readers look weights up in an immutable snapshot, see `nano::versioned_snapshot`.
+ * Writers are serialized and publish a new snapshot for every change. To keep writes cheap, recent changes are kept in a
+ * small delta table on top of a shared base table, which is only rebuilt once the delta grows past `delta_max` entries.
+ */
 class rep_weights
 {
+private:
+	class table;
+
 public:
+	/** Collects weights loaded from the database table, so they can be added to the cache with a single publish */
+	class builder final
+	{
+	public:
+		builder ();
+		~builder ();
+		void add (nano::account const &, nano::uint128_t const &);
+
+	private:
+		std::unique_ptr<table> weights;
+		friend class rep_weights;
+	};
+
 	explicit rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a = 0);
 	void representation_add (store::write_transaction const & txn_a, nano::account const & source_rep_a, nano::uint128_t const & amount_a);
 	void representation_add_dual (store::write_transaction const & txn_a, nano::account const & source_rep_1, nano::uint128_t const & amount_1, nano::account const & source_rep_2, nano::uint128_t const & amount_2);
@@ -28,17 +54,92 @@ public:
 	void representation_put (nano::account const & account_a, nano::uint128_t const & representation_a);
 	std::unordered_map<nano::account, nano::uint128_t> get_rep_amounts () const;
 	/* Only use this method when loading rep weights from the database table */
-	void copy_from (rep_weights & other_a);
+	void add (builder const & builder_a);
 	size_t size () const;
+	/* Weights below this amount are not cached */
+	nano::uint128_t min_weight_get () const;
 	nano::container_info container_info () const;
 
+	/** Number of changed representatives kept on top of the base table before it is rebuilt */
+	static std::size_t constexpr delta_max = 512;
+
 private:
-	mutable std::shared_mutex mutex;
-	std::unordered_map<nano::account, nano::uint128_t> rep_amounts;
+	/** Open addressing hash table with linear probing, entries are never erased */
+	class table final
+	{
+	public:
+		nano::uint128_t const * find (nano::account const &) const;
+		void put (nano::account const &, nano::uint128_t const &);
+		std::size_t size () const;
+
+		template <typename Func>
+		void for_each (Func const & func) const
+		{
+			for (auto const & entry : entries)
+			{
+				if (entry.used)
+				{
+					func (entry.account, entry.amount);
+				}
+			}
+		}
+
+	private:
+		class entry final
+		{
+		public:
+			nano::account account{};
+			nano::uint128_t amount{ 0 };
+			bool used{ false };
+		};
+
+		std::size_t slot (nano::account const &) const;
+		void grow ();
+
+		std::vector<entry> entries;
+		std::size_t count{ 0 };
+	};
+
+	class snapshot final
+	{
+	public:
+		nano::uint128_t get (nano::account const &) const;
+
+		/** Visits every representative with a non-zero cached weight */
+		template <typename Func>
+		void for_each (Func const & func) const
+		{
+			base->for_each ([&] (nano::account const & account, nano::uint128_t const & amount) {
+				if (delta.find (account) == nullptr)
+				{
+					func (account, amount);
+				}
+			});
+			delta.for_each ([&] (nano::account const & account, nano::uint128_t const & amount) {
+				if (amount != 0)
+				{
+					func (account, amount);
+				}
+			});
+		}
+
+		std::shared_ptr<table const> base;
+		/** Changes since the base was built, a zero amount marks a removed representative */
+		table delta;
+		/** Number of representatives with a non-zero cached weight */
+		std::size_t size{ 0 };
+	};
+
+	using changes_t = std::vector<std::pair<nano::account, nano::uint128_t>>;
+
+	/** Publishes a snapshot with the new weights of the changed representatives. Must be called with `mutex` held */
+	void put_cache (changes_t const & changes_a);
+	void put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a);
+
+	nano::versioned_snapshot<snapshot> current;
+	/** Serializes writers */
+	mutable nano::mutex mutex;
 	nano::store::rep_weight & rep_weight_store;
 	nano::uint128_t min_weight;
-	void put_cache (nano::account const & account_a, nano::uint128_union const & representation_a);
-	void put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a);
-	nano::uint128_t get (nano::account const & account_a) const;
 };
 }
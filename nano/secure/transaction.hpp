@@ -3,7 +3,9 @@
 #include <nano/store/transaction.hpp>
 #include <nano/store/write_queue.hpp>
 
+#include <functional>
 #include <utility>
+#include <vector>
 
 namespace nano::secure
 {
@@ -34,6 +36,8 @@ class write_transaction final : public transaction
 	nano::store::write_guard guard; // Guard should be released after the transaction
 	nano::store::write_transaction txn;
 	std::chrono::steady_clock::time_point start;
+	// Mutable as writes are made through const references, registering a callback does not change the transaction
+	mutable std::vector<std::function<void ()>> commit_callbacks;
 
 public:
 	explicit write_transaction (nano::store::write_transaction && txn_a, nano::store::write_guard && guard_a) noexcept :
@@ -44,6 +48,27 @@ public:
 		start = std::chrono::steady_clock::now ();
 	}
 
+	write_transaction (write_transaction &&) noexcept = default;
+	write_transaction & operator= (write_transaction &&) noexcept = default;
+
+	~write_transaction ()
+	{
+		// The store transaction commits when destroyed, callbacks have to run before the write guard is released
+		if (!commit_callbacks.empty ())
+		{
+			commit ();
+		}
+	}
+
+	/**
+	 * Runs `callback' once the changes made so far are committed, while other writers are still excluded
+	 * Used to publish state that must not become visible to other transactions before the data it describes
+	 */
+	void on_commit (std::function<void ()> callback) const
+	{
+		commit_callbacks.push_back (std::move (callback));
+	}
+
 	// Override to return a reference to the encapsulated write_transaction
 	const nano::store::transaction & base_txn () const override
 	{
@@ -53,6 +78,23 @@ public:
 	void commit ()
 	{
 		txn.commit ();
+		auto callbacks = std::move (commit_callbacks);
+		commit_callbacks.clear ();
+		for (auto const & callback : callbacks)
+		{
+			callback ();
+		}
+		guard.release ();
+	}
+
+	/**
+	 * Discards the changes made so far together with their commit callbacks
+	 * In-memory state updated alongside the writes, such as the ledger cache, is not restored
+	 */
+	void abort ()
+	{
+		txn.abort ();
+		commit_callbacks.clear ();
 		guard.release ();
 	}
 
@@ -62,6 +62,30 @@ std::size_t nano::vote::size (uint8_t count)
 	return partial_size + count * sizeof (nano::block_hash);
 }
 
+std::shared_ptr<std::vector<uint8_t> const> nano::vote::wire_bytes () const
+{
+	auto result = wire_bytes_m.get ();
+#ifndef NDEBUG
+	if (result)
+	{
+		// Signed votes are not supposed to change, stale bytes would relay a different vote
+		std::vector<uint8_t> bytes;
+		{
+			nano::vectorstream stream{ bytes };
+			serialize (stream);
+		}
+		debug_assert (*result == bytes);
+	}
+#endif
+	return result;
+}
+
+void nano::vote::wire_bytes_set (std::shared_ptr<std::vector<uint8_t> const> const & bytes_a)
+{
+	debug_assert (bytes_a == nullptr || bytes_a->size () == size (static_cast<uint8_t> (hashes.size ())));
+	wire_bytes_m.set (bytes_a);
+}
+
 std::string const nano::vote::hash_prefix = "vote ";
 
 nano::block_hash nano::vote::hash () const
@@ -2,6 +2,7 @@
 
 #include <nano/lib/fwd.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/serialized_bytes.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/lib/uniquer.hpp>
 
@@ -28,6 +29,11 @@ public:
 	bool deserialize (nano::stream &);
 	static std::size_t size (uint8_t count);
 
+	/** Serialized vote as received from the network or as generated, reused when the vote is sent again. nullptr if not set */
+	std::shared_ptr<std::vector<uint8_t> const> wire_bytes () const;
+	/** Only call before the vote is uniqued or otherwise shared */
+	void wire_bytes_set (std::shared_ptr<std::vector<uint8_t> const> const &);
+
 	nano::block_hash hash () const;
 	nano::block_hash full_hash () const;
 	bool validate () const;
@@ -67,6 +73,8 @@ private: // Payload
 	uint64_t timestamp_m{ 0 };
 
 private:
+	nano::serialized_bytes wire_bytes_m;
+
 	// Size of vote payload without hashes
 	static std::size_t constexpr partial_size = sizeof (account) + sizeof (signature) + sizeof (timestamp_m);
 	static std::string const hash_prefix;
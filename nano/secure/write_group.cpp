@@ -0,0 +1,175 @@
+#include <nano/lib/enum_util.hpp>
+#include <nano/lib/stats.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/secure/ledger.hpp>
+#include <nano/secure/transaction.hpp>
+#include <nano/secure/write_group.hpp>
+
+#include <stdexcept>
+
+nano::write_group::write_group (nano::ledger const & ledger_a, nano::stats & stats_a) :
+	ledger{ ledger_a },
+	stats{ stats_a }
+{
+}
+
+void nano::write_group::submit (nano::store::writer writer, work_t const & work)
+{
+	request request{ writer, work, std::chrono::steady_clock::now () };
+
+	if (!enabled)
+	{
+		{
+			auto transaction = ledger.tx_begin_write (writer);
+			try
+			{
+				work (transaction);
+			}
+			catch (...)
+			{
+				transaction.abort ();
+				throw;
+			}
+		}
+		stats.inc (nano::stat::type::write_group, nano::stat::detail::commit);
+		finish (request);
+		return;
+	}
+
+	nano::unique_lock<nano::mutex> lock{ mutex };
+	pending.push_back (&request);
+	while (!request.done)
+	{
+		if (!leading)
+		{
+			// Our request might not be part of the group if too many writers are pending, in that case lead again
+			try
+			{
+				lead (lock, writer);
+			}
+			catch (...)
+			{
+				// The write transaction could not be started, our request is still pending and must not outlive this call
+				std::erase (pending, &request);
+				throw;
+			}
+		}
+		else
+		{
+			condition.wait (lock);
+		}
+	}
+	if (request.error)
+	{
+		std::rethrow_exception (request.error);
+	}
+}
+
+std::size_t nano::write_group::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return pending.size ();
+}
+
+void nano::write_group::lead (nano::unique_lock<nano::mutex> & lock, nano::store::writer writer)
+{
+	debug_assert (lock.owns_lock ());
+	debug_assert (!leading);
+	leader_guard guard{ *this, lock };
+	auto & group = guard.group;
+	lock.unlock ();
+
+	// Writers submitting while we wait for the write queue join this group
+	auto transaction = ledger.tx_begin_write (writer);
+
+	auto expired = [&transaction] () {
+		return std::chrono::steady_clock::now () - transaction.timestamp () > max_transaction_age;
+	};
+
+	bool failed = false;
+	lock.lock ();
+	while (!failed && !pending.empty () && group.size () < max_group_size && !expired ())
+	{
+		auto * next = pending.front ();
+		pending.pop_front ();
+		group.push_back (next);
+
+		lock.unlock ();
+		auto const epoch = transaction.base_txn ().epoch ();
+		try
+		{
+			next->work (transaction);
+		}
+		catch (...)
+		{
+			next->error = std::current_exception ();
+			failed = true;
+		}
+		debug_assert (transaction.base_txn ().epoch () == epoch, "work must not commit or refresh the shared transaction");
+		lock.lock ();
+	}
+	lock.unlock ();
+
+	if (failed)
+	{
+		// Writes of the failed work cannot be separated from the rest, none of the group is committed
+		transaction.abort ();
+		for (auto * request : group)
+		{
+			if (!request->error)
+			{
+				request->error = std::make_exception_ptr (std::runtime_error{ "Write group aborted" });
+			}
+		}
+		stats.inc (nano::stat::type::write_group, nano::stat::detail::aborted);
+		return;
+	}
+
+	transaction.commit ();
+
+	stats.inc (nano::stat::type::write_group, nano::stat::detail::commit);
+	stats.add (nano::stat::type::write_group, nano::stat::detail::grouped, group.size () - 1);
+	stats.sample (nano::stat::sample::write_group_size, group.size (), { 1, max_group_size });
+	for (auto const * request : group)
+	{
+		finish (*request);
+	}
+}
+
+nano::write_group::leader_guard::leader_guard (write_group & owner_a, nano::unique_lock<nano::mutex> & lock_a) :
+	owner{ owner_a },
+	lock{ lock_a },
+	exceptions{ std::uncaught_exceptions () }
+{
+	debug_assert (lock.owns_lock ());
+	owner.leading = true;
+}
+
+nano::write_group::leader_guard::~leader_guard ()
+{
+	if (!lock.owns_lock ())
+	{
+		lock.lock ();
+	}
+	// When unwinding the transaction failed, every writer in the group has to learn about it
+	auto const failed = std::uncaught_exceptions () > exceptions;
+	for (auto * request : group)
+	{
+		if (failed && !request->error)
+		{
+			request->error = std::make_exception_ptr (std::runtime_error{ "Write group transaction failed" });
+		}
+		request->done = true;
+	}
+	owner.leading = false;
+	owner.condition.notify_all ();
+}
+
+void nano::write_group::finish (request const & request)
+{
+	auto const writer_detail = nano::enum_util::cast<nano::stat::detail> (request.writer);
+	auto const latency = std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - request.submitted);
+	stats.inc (nano::stat::type::write_group_writer, writer_detail);
+	// Total time from submission until the work was committed, in microseconds
+	stats.add (nano::stat::type::write_group_latency, writer_detail, latency.count ());
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/store/write_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+
+namespace nano
+{
+class ledger;
+class stats;
+}
+namespace nano::secure
+{
+class write_transaction;
+}
+
+namespace nano
+{
+/**
+ * Group commit of ledger writes
+ * Writers submit their work instead of opening a write transaction themselves. The first writer to arrive becomes the leader,
+ * acquires the write queue and executes its own work together with the work of every writer submitting in the meantime,
+ * all in one write transaction that is committed once. Followers block until the transaction containing their work is committed.
+ * Work always runs on the leader thread, as write transactions must not be shared between threads.
+ * Work must not commit or refresh the transaction, long running work should return and submit the rest separately.
+ * If any work throws, the whole transaction is aborted and every writer in the group fails.
+ */
+class write_group final
+{
+public:
+	using work_t = std::function<void (secure::write_transaction &)>;
+
+	write_group (nano::ledger const &, nano::stats &);
+
+	/**
+	 * Executes `work` inside a write transaction and returns once that transaction is committed
+	 * Throws if `work` or the transaction fails, or if the work of another writer aborted the shared transaction
+	 */
+	void submit (nano::store::writer, work_t const & work);
+
+	/** Number of writers waiting for their work to be executed */
+	std::size_t size () const;
+
+	/** When disabled every writer uses its own write transaction */
+	std::atomic<bool> enabled{ true };
+
+	/** Maximum number of writers sharing a single write transaction */
+	static std::size_t constexpr max_group_size = 16;
+
+	/** No more work joins a transaction older than this, matches the default age of `refresh_if_needed` */
+	static std::chrono::milliseconds constexpr max_transaction_age{ 500 };
+
+private:
+	class request final
+	{
+	public:
+		nano::store::writer writer;
+		work_t const & work;
+		std::chrono::steady_clock::time_point submitted;
+		bool done{ false };
+		std::exception_ptr error;
+	};
+
+	/** Releases the group and hands leadership over when the leader is done, also when it fails */
+	class leader_guard final
+	{
+	public:
+		leader_guard (write_group &, nano::unique_lock<nano::mutex> &);
+		~leader_guard ();
+
+		std::deque<request *> group;
+
+	private:
+		write_group & owner;
+		nano::unique_lock<nano::mutex> & lock;
+		int const exceptions;
+	};
+
+	void lead (nano::unique_lock<nano::mutex> &, nano::store::writer);
+	void finish (request const &);
+
+private:
+	nano::ledger const & ledger;
+	nano::stats & stats;
+
+	std::deque<request *> pending;
+	bool leading{ false };
+	mutable nano::mutex mutex;
+	nano::condition_variable condition;
+};
+}
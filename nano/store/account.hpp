@@ -7,6 +7,8 @@
 #include <nano/store/typed_iterator.hpp>
 
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -28,6 +30,8 @@ public:
 	virtual void put (write_transaction const & tx, nano::account const &, nano::account_info const &) = 0;
 	virtual bool get (transaction const & tx, nano::account const &, nano::account_info &) = 0;
 	std::optional<nano::account_info> get (transaction const & tx, nano::account const &);
+	/** Batched `get`, result entries are in the same order as the accounts */
+	virtual std::vector<std::optional<nano::account_info>> get_multi (transaction const & tx, std::vector<nano::account> const &) = 0;
 	virtual void del (write_transaction const & tx, nano::account const &) = 0;
 	virtual bool exists (transaction const & tx, nano::account const &) = 0;
 	virtual size_t count (transaction const & tx) = 0;
@@ -8,6 +8,7 @@
 
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -18,6 +19,8 @@ namespace nano::store
 {
 /**
  * Manages block storage and iteration
+ * Successors are kept in their own table so stored block values are never rewritten once inserted. The successor field embedded
+ * in stored sidebands is unused, blocks returned by `get` have it filled from the successor table while iterated blocks do not
  */
 class block
 {
@@ -28,8 +31,11 @@ public:
 	virtual void put (write_transaction const & tx, nano::block_hash const &, nano::block const &) = 0;
 	virtual void raw_put (write_transaction const & tx, std::vector<uint8_t> const &, nano::block_hash const &) = 0;
 	virtual std::optional<nano::block_hash> successor (transaction const & tx, nano::block_hash const &) const = 0;
+	virtual void successor_put (write_transaction const & tx, nano::block_hash const &, nano::block_hash const & successor) = 0;
 	virtual void successor_clear (write_transaction const & tx, nano::block_hash const &) = 0;
 	virtual std::shared_ptr<nano::block> get (transaction const & tx, nano::block_hash const &) const = 0;
+	/** Batched `get`, result entries are in the same order as the hashes and null for blocks not found */
+	virtual std::vector<std::shared_ptr<nano::block>> get_multi (transaction const & tx, std::vector<nano::block_hash> const &) const = 0;
 	virtual std::shared_ptr<nano::block> random (transaction const & tx) = 0;
 	virtual void del (write_transaction const & tx, nano::block_hash const &) = 0;
 	virtual bool exists (transaction const & tx, nano::block_hash const &) = 0;
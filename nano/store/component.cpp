@@ -5,9 +5,11 @@
 #include <nano/store/block.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/confirmation_height.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/height.hpp>
 #include <nano/store/rep_weight.hpp>
 
-nano::store::component::component (nano::store::block & block_store_a, nano::store::account & account_store_a, nano::store::pending & pending_store_a, nano::store::online_weight & online_weight_store_a, nano::store::pruned & pruned_store_a, nano::store::peer & peer_store_a, nano::store::confirmation_height & confirmation_height_store_a, nano::store::final_vote & final_vote_store_a, nano::store::version & version_store_a, nano::store::rep_weight & rep_weight_a) :
+nano::store::component::component (nano::store::block & block_store_a, nano::store::account & account_store_a, nano::store::pending & pending_store_a, nano::store::online_weight & online_weight_store_a, nano::store::pruned & pruned_store_a, nano::store::peer & peer_store_a, nano::store::confirmation_height & confirmation_height_store_a, nano::store::final_vote & final_vote_store_a, nano::store::version & version_store_a, nano::store::rep_weight & rep_weight_a, nano::store::delegator & delegator_a, nano::store::height & height_a) :
 	block (block_store_a),
 	account (account_store_a),
 	pending (pending_store_a),
@@ -17,7 +19,9 @@ nano::store::component::component (nano::store::block & block_store_a, nano::sto
 	confirmation_height (confirmation_height_store_a),
 	final_vote (final_vote_store_a),
 	version (version_store_a),
-	rep_weight (rep_weight_a)
+	rep_weight (rep_weight_a),
+	delegator (delegator_a),
+	height (height_a)
 {
 }
 
@@ -31,10 +35,12 @@ void nano::store::component::initialize (store::write_transaction const & transa
 	debug_assert (account.begin (transaction_a) == account.end (transaction_a));
 	auto hash_l (constants.genesis->hash ());
 	block.put (transaction_a, hash_l, *constants.genesis);
+	height.put (transaction_a, constants.genesis->account (), 1, hash_l);
 	++ledger_cache_a.block_count;
 	confirmation_height.put (transaction_a, constants.genesis->account (), nano::confirmation_height_info{ 1, constants.genesis->hash () });
 	++ledger_cache_a.cemented_count;
 	account.put (transaction_a, constants.genesis->account (), { hash_l, constants.genesis->account (), constants.genesis->hash (), std::numeric_limits<nano::uint128_t>::max (), nano::seconds_since_epoch (), 1, nano::epoch::epoch_0 });
+	delegator.put (transaction_a, constants.genesis->account (), constants.genesis->account ());
 	++ledger_cache_a.account_count;
 	rep_weight.put (transaction_a, constants.genesis->account (), std::numeric_limits<nano::uint128_t>::max ());
 	ledger_cache_a.rep_weights.representation_put (constants.genesis->account (), std::numeric_limits<nano::uint128_t>::max ());
@@ -40,7 +40,9 @@ namespace store
 		nano::store::confirmation_height &,
 		nano::store::final_vote &,
 		nano::store::version &,
-		nano::store::rep_weight &
+		nano::store::rep_weight &,
+		nano::store::delegator &,
+		nano::store::height &
 	);
 		// clang-format on
 		virtual ~component () = default;
@@ -56,8 +58,10 @@ namespace store
 		store::account & account;
 		store::pending & pending;
 		store::rep_weight & rep_weight;
+		store::delegator & delegator;
+		store::height & height;
 		static int constexpr version_minimum{ 21 };
-		static int constexpr version_current{ 24 };
+		static int constexpr version_current{ 27 };
 
 	public:
 		store::online_weight & online_weight;
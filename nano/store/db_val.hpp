@@ -14,6 +14,8 @@ namespace nano
 class account_info;
 class account_info_v22;
 class block;
+class delegator_key;
+class height_key;
 class pending_info;
 class pending_key;
 class vote;
@@ -71,6 +73,10 @@ public:
 
 	db_val (nano::pending_key const & val_a);
 
+	db_val (nano::delegator_key const & val_a);
+
+	db_val (nano::height_key const & val_a);
+
 	db_val (nano::confirmation_height_info const & val_a) :
 		buffer (std::make_shared<std::vector<uint8_t>> ())
 	{
@@ -122,6 +128,10 @@ public:
 
 	explicit operator nano::pending_key () const;
 
+	explicit operator nano::delegator_key () const;
+
+	explicit operator nano::height_key () const;
+
 	explicit operator nano::confirmation_height_info () const
 	{
 		nano::bufferstream stream (reinterpret_cast<uint8_t const *> (data ()), size ());
@@ -2,6 +2,8 @@
 
 #include <nano/lib/blocks.hpp>
 #include <nano/secure/account_info.hpp>
+#include <nano/secure/delegator_key.hpp>
+#include <nano/secure/height_key.hpp>
 #include <nano/secure/pending_info.hpp>
 #include <nano/store/db_val.hpp>
 
@@ -42,6 +44,24 @@ nano::store::db_val<T>::db_val (nano::pending_key const & val_a) :
 	static_assert (std::is_standard_layout<nano::pending_key>::value, "Standard layout is required");
 }
 
+template <typename T>
+nano::store::db_val<T>::db_val (nano::delegator_key const & val_a) :
+	db_val (sizeof (val_a), const_cast<nano::delegator_key *> (&val_a))
+{
+	static_assert (std::is_standard_layout<nano::delegator_key>::value, "Standard layout is required");
+}
+
+template <typename T>
+nano::store::db_val<T>::db_val (nano::height_key const & val_a) :
+	buffer (std::make_shared<std::vector<uint8_t>> ())
+{
+	{
+		nano::vectorstream stream (*buffer);
+		val_a.serialize (stream);
+	}
+	convert_buffer_to_value ();
+}
+
 template <typename T>
 nano::store::db_val<T>::operator nano::account_info () const
 {
@@ -98,3 +118,25 @@ nano::store::db_val<T>::operator nano::pending_key () const
 	std::copy (reinterpret_cast<uint8_t const *> (data ()), reinterpret_cast<uint8_t const *> (data ()) + sizeof (result), reinterpret_cast<uint8_t *> (&result));
 	return result;
 }
+
+template <typename T>
+nano::store::db_val<T>::operator nano::delegator_key () const
+{
+	nano::delegator_key result;
+	debug_assert (size () == sizeof (result));
+	static_assert (sizeof (nano::delegator_key::representative) + sizeof (nano::delegator_key::account) == sizeof (result), "Packed class");
+	std::copy (reinterpret_cast<uint8_t const *> (data ()), reinterpret_cast<uint8_t const *> (data ()) + sizeof (result), reinterpret_cast<uint8_t *> (&result));
+	return result;
+}
+
+template <typename T>
+nano::store::db_val<T>::operator nano::height_key () const
+{
+	debug_assert (size () == nano::height_key::size);
+	nano::bufferstream stream (reinterpret_cast<uint8_t const *> (data ()), size ());
+	nano::height_key result;
+	auto error (result.deserialize (stream));
+	(void)error;
+	debug_assert (!error);
+	return result;
+}
@@ -0,0 +1,5 @@
+#include <nano/secure/delegator_key.hpp>
+#include <nano/store/delegator.hpp>
+#include <nano/store/typed_iterator_templ.hpp>
+
+template class nano::store::typed_iterator<nano::delegator_key, std::nullptr_t>;
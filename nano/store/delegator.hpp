@@ -0,0 +1,35 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/typed_iterator.hpp>
+
+#include <functional>
+
+namespace nano
+{
+class delegator_key;
+}
+namespace nano::store
+{
+/**
+ * Secondary index of the accounts table, mapping each representative to the accounts delegating to it
+ * nano::delegator_key (representative, account) -> none
+ */
+class delegator
+{
+public:
+	using iterator = typed_iterator<nano::delegator_key, std::nullptr_t>;
+
+public:
+	virtual void put (store::write_transaction const &, nano::account const & representative, nano::account const & account) = 0;
+	virtual void del (store::write_transaction const &, nano::account const & representative, nano::account const & account) = 0;
+	virtual bool exists (store::transaction const &, nano::account const & representative, nano::account const & account) const = 0;
+	virtual uint64_t count (store::transaction const &) const = 0;
+	virtual void clear (store::write_transaction const &) = 0;
+	virtual iterator begin (store::transaction const &, nano::delegator_key const &) const = 0;
+	virtual iterator begin (store::transaction const &) const = 0;
+	virtual iterator end (store::transaction const &) const = 0;
+	virtual void for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const = 0;
+};
+} // namespace nano::store
@@ -10,7 +10,9 @@ class account;
 class block;
 class component;
 class confirmation_height;
+class delegator;
 class final_vote;
+class height;
 class online_weight;
 class peer;
 class pending;
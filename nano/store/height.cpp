@@ -0,0 +1,5 @@
+#include <nano/secure/height_key.hpp>
+#include <nano/store/height.hpp>
+#include <nano/store/typed_iterator_templ.hpp>
+
+template class nano::store::typed_iterator<nano::height_key, nano::block_hash>;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+#include <nano/store/component.hpp>
+#include <nano/store/typed_iterator.hpp>
+
+#include <functional>
+#include <optional>
+
+namespace nano
+{
+class height_key;
+}
+namespace nano::store
+{
+/**
+ * Secondary index of the blocks table, mapping each position in an account chain to the block at that position
+ * Pruned blocks are not indexed
+ * nano::height_key (account, height) -> nano::block_hash
+ */
+class height
+{
+public:
+	using iterator = typed_iterator<nano::height_key, nano::block_hash>;
+
+public:
+	virtual void put (store::write_transaction const &, nano::account const & account, uint64_t height, nano::block_hash const & hash) = 0;
+	virtual void del (store::write_transaction const &, nano::account const & account, uint64_t height) = 0;
+	virtual std::optional<nano::block_hash> get (store::transaction const &, nano::account const & account, uint64_t height) const = 0;
+	virtual uint64_t count (store::transaction const &) const = 0;
+	virtual void clear (store::write_transaction const &) = 0;
+	virtual iterator begin (store::transaction const &, nano::height_key const &) const = 0;
+	virtual iterator begin (store::transaction const &) const = 0;
+	virtual iterator end (store::transaction const &) const = 0;
+	virtual void for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const = 0;
+};
+} // namespace nano::store
@@ -3,25 +3,23 @@
 #include <nano/store/lmdb/block.hpp>
 #include <nano/store/lmdb/lmdb.hpp>
 
-namespace nano::store::lmdb
-{
-/**
- * Fill in our predecessors
- */
-class block_predecessor_mdb_set : public nano::block_visitor
-{
-public:
-	block_predecessor_mdb_set (store::write_transaction const & transaction_a, nano::store::lmdb::block & block_store_a);
-	virtual ~block_predecessor_mdb_set () = default;
-	void fill_value (nano::block const & block_a);
-	void send_block (nano::send_block const & block_a) override;
-	void receive_block (nano::receive_block const & block_a) override;
-	void open_block (nano::open_block const & block_a) override;
-	void change_block (nano::change_block const & block_a) override;
-	void state_block (nano::state_block const & block_a) override;
-	store::write_transaction const & transaction;
-	nano::store::lmdb::block & block_store;
-};
+namespace
+{
+std::shared_ptr<nano::block> block_from_value (nano::store::lmdb::db_val const & value, nano::block_hash const & successor)
+{
+	nano::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
+	nano::block_type type;
+	auto error (try_read (stream, type));
+	release_assert (!error);
+	auto result = nano::deserialize_block (stream, type);
+	release_assert (result != nullptr);
+	nano::block_sideband sideband;
+	error = (sideband.deserialize (stream, type));
+	release_assert (!error);
+	sideband.successor = successor;
+	result->sideband_set (sideband);
+	return result;
+}
 }
 
 nano::store::lmdb::block::block (nano::store::lmdb::component & store_a) :
@@ -34,11 +32,20 @@ void nano::store::lmdb::block::put (store::write_transaction const & transaction
 	{
 		nano::vectorstream stream (vector);
 		nano::serialize_block (stream, block);
-		block.sideband ().serialize (stream, block.type ());
+		// Successors live in their own table, the stored value never changes after this point
+		auto sideband = block.sideband ();
+		sideband.successor.clear ();
+		sideband.serialize (stream, block.type ());
 	}
 	raw_put (transaction, vector, hash);
-	block_predecessor_mdb_set predecessor (transaction, *this);
-	block.visit (predecessor);
+	if (!block.sideband ().successor.is_zero ())
+	{
+		successor_put (transaction, hash, block.sideband ().successor);
+	}
+	if (!block.previous ().is_zero ())
+	{
+		successor_put (transaction, block.previous (), hash);
+	}
 	debug_assert (block.previous ().is_zero () || successor (transaction, block.previous ()) == hash);
 }
 
@@ -52,37 +59,26 @@ void nano::store::lmdb::block::raw_put (store::write_transaction const & transac
 std::optional<nano::block_hash> nano::store::lmdb::block::successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const
 {
 	nano::store::lmdb::db_val value;
-	block_raw_get (transaction_a, hash_a, value);
-	nano::block_hash result;
-	if (value.size () != 0)
-	{
-		debug_assert (value.size () >= result.bytes.size ());
-		auto type = block_type_from_raw (value.data ());
-		nano::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()) + block_successor_offset (transaction_a, value.size (), type), result.bytes.size ());
-		auto error (nano::try_read (stream, result.bytes));
-		(void)error;
-		debug_assert (!error);
-	}
-	else
-	{
-		result.clear ();
-	}
-	if (result.is_zero ())
+	auto status = store.get (transaction_a, tables::successors, hash_a, value);
+	release_assert (store.success (status) || store.not_found (status));
+	if (!store.success (status))
 	{
 		return std::nullopt;
 	}
-	return result;
+	return static_cast<nano::block_hash> (value);
+}
+
+void nano::store::lmdb::block::successor_put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash const & successor_a)
+{
+	debug_assert (!successor_a.is_zero ());
+	auto status = store.put (transaction_a, tables::successors, hash_a, successor_a);
+	store.release_assert_success (status);
 }
 
 void nano::store::lmdb::block::successor_clear (store::write_transaction const & transaction, nano::block_hash const & hash)
 {
-	nano::store::lmdb::db_val value;
-	block_raw_get (transaction, hash, value);
-	debug_assert (value.size () != 0);
-	auto type = block_type_from_raw (value.data ());
-	std::vector<uint8_t> data (static_cast<uint8_t *> (value.data ()), static_cast<uint8_t *> (value.data ()) + value.size ());
-	std::fill_n (data.begin () + block_successor_offset (transaction, value.size (), type), sizeof (nano::block_hash), uint8_t{ 0 });
-	raw_put (transaction, data, hash);
+	auto status = store.del (transaction, tables::successors, hash);
+	release_assert (store.success (status) || store.not_found (status));
 }
 
 std::shared_ptr<nano::block> nano::store::lmdb::block::get (store::transaction const & transaction, nano::block_hash const & hash) const
@@ -92,16 +88,26 @@ std::shared_ptr<nano::block> nano::store::lmdb::block::get (store::transaction c
 	std::shared_ptr<nano::block> result;
 	if (value.size () != 0)
 	{
-		nano::bufferstream stream (reinterpret_cast<uint8_t const *> (value.data ()), value.size ());
-		nano::block_type type;
-		auto error (try_read (stream, type));
-		release_assert (!error);
-		result = nano::deserialize_block (stream, type);
-		release_assert (result != nullptr);
-		nano::block_sideband sideband;
-		error = (sideband.deserialize (stream, type));
-		release_assert (!error);
-		result->sideband_set (sideband);
+		result = block_from_value (value, successor (transaction, hash).value_or (nano::block_hash{ 0 }));
+	}
+	return result;
+}
+
+std::vector<std::shared_ptr<nano::block>> nano::store::lmdb::block::get_multi (store::transaction const & transaction, std::vector<nano::block_hash> const & hashes) const
+{
+	std::vector<nano::store::lmdb::db_val> keys (hashes.begin (), hashes.end ());
+	std::vector<nano::store::lmdb::db_val> values;
+	std::vector<nano::store::lmdb::db_val> successors;
+	auto const statuses = store.get_multi (transaction, tables::blocks, keys, values);
+	auto const successor_statuses = store.get_multi (transaction, tables::successors, keys, successors);
+	std::vector<std::shared_ptr<nano::block>> result (hashes.size ());
+	for (std::size_t i = 0; i < hashes.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			result[i] = block_from_value (values[i], store.success (successor_statuses[i]) ? static_cast<nano::block_hash> (successors[i]) : nano::block_hash{ 0 });
+		}
 	}
 	return result;
 }
@@ -123,6 +129,7 @@ void nano::store::lmdb::block::del (store::write_transaction const & transaction
 {
 	auto status = store.del (transaction_a, tables::blocks, hash_a);
 	store.release_assert_success (status);
+	successor_clear (transaction_a, hash_a);
 }
 
 bool nano::store::lmdb::block::exists (store::transaction const & transaction, nano::block_hash const & hash)
@@ -165,54 +172,3 @@ void nano::store::lmdb::block::block_raw_get (store::transaction const & transac
 	auto status = store.get (transaction, tables::blocks, hash, value);
 	release_assert (store.success (status) || store.not_found (status));
 }
-
-size_t nano::store::lmdb::block::block_successor_offset (store::transaction const & transaction_a, size_t entry_size_a, nano::block_type type_a) const
-{
-	return entry_size_a - nano::block_sideband::size (type_a);
-}
-
-nano::block_type nano::store::lmdb::block::block_type_from_raw (void * data_a)
-{
-	// The block type is the first byte
-	return static_cast<nano::block_type> ((reinterpret_cast<uint8_t const *> (data_a))[0]);
-}
-
-nano::store::lmdb::block_predecessor_mdb_set::block_predecessor_mdb_set (store::write_transaction const & transaction_a, nano::store::lmdb::block & block_store_a) :
-	transaction{ transaction_a },
-	block_store{ block_store_a }
-{
-}
-void nano::store::lmdb::block_predecessor_mdb_set::fill_value (nano::block const & block_a)
-{
-	auto hash = block_a.hash ();
-	nano::store::lmdb::db_val value;
-	block_store.block_raw_get (transaction, block_a.previous (), value);
-	debug_assert (value.size () != 0);
-	auto type = block_store.block_type_from_raw (value.data ());
-	std::vector<uint8_t> data (static_cast<uint8_t *> (value.data ()), static_cast<uint8_t *> (value.data ()) + value.size ());
-	std::copy (hash.bytes.begin (), hash.bytes.end (), data.begin () + block_store.block_successor_offset (transaction, value.size (), type));
-	block_store.raw_put (transaction, data, block_a.previous ());
-}
-void nano::store::lmdb::block_predecessor_mdb_set::send_block (nano::send_block const & block_a)
-{
-	fill_value (block_a);
-}
-void nano::store::lmdb::block_predecessor_mdb_set::receive_block (nano::receive_block const & block_a)
-{
-	fill_value (block_a);
-}
-void nano::store::lmdb::block_predecessor_mdb_set::open_block (nano::open_block const & block_a)
-{
-	// Open blocks don't have a predecessor
-}
-void nano::store::lmdb::block_predecessor_mdb_set::change_block (nano::change_block const & block_a)
-{
-	fill_value (block_a);
-}
-void nano::store::lmdb::block_predecessor_mdb_set::state_block (nano::state_block const & block_a)
-{
-	if (!block_a.previous ().is_zero ())
-	{
-		fill_value (block_a);
-	}
-}
@@ -5,10 +5,6 @@
 
 #include <lmdb/libraries/liblmdb/lmdb.h>
 
-namespace nano::store::lmdb
-{
-class block_predecessor_mdb_set;
-}
 namespace nano::store::lmdb
 {
 class component;
@@ -17,7 +13,6 @@ namespace nano::store::lmdb
 {
 class block : public nano::store::block
 {
-	friend class block_predecessor_mdb_set;
 	nano::store::lmdb::component & store;
 
 public:
@@ -25,8 +20,10 @@ public:
 	void put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block const & block_a) override;
 	void raw_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & data, nano::block_hash const & hash_a) override;
 	std::optional<nano::block_hash> successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	void successor_put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash const & successor_a) override;
 	void successor_clear (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	std::shared_ptr<nano::block> get (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	std::vector<std::shared_ptr<nano::block>> get_multi (store::transaction const & transaction_a, std::vector<nano::block_hash> const & hashes_a) const override;
 	std::shared_ptr<nano::block> random (store::transaction const & transaction_a) override;
 	void del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	bool exists (store::transaction const & transaction_a, nano::block_hash const & hash_a) override;
@@ -42,9 +39,13 @@ public:
 	 */
 	MDB_dbi blocks_handle{ 0 };
 
+	/**
+	 * Maps blocks to the next block in their account chain
+	 * nano::block_hash -> nano::block_hash
+	 */
+	MDB_dbi successors_handle{ 0 };
+
 protected:
 	void block_raw_get (store::transaction const & transaction_a, nano::block_hash const & hash_a, db_val & value) const;
-	size_t block_successor_offset (store::transaction const & transaction_a, size_t entry_size_a, nano::block_type type_a) const;
-	static nano::block_type block_type_from_raw (void * data_a);
 };
 } // namespace nano::store::lmdb
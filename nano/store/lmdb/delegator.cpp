@@ -0,0 +1,60 @@
+#include <nano/secure/delegator_key.hpp>
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/lmdb/delegator.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+
+nano::store::lmdb::delegator::delegator (nano::store::lmdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::lmdb::delegator::put (store::write_transaction const & transaction_a, nano::account const & representative_a, nano::account const & account_a)
+{
+	auto status = store.put (transaction_a, tables::delegators, nano::delegator_key{ representative_a, account_a }, nullptr);
+	store.release_assert_success (status);
+}
+
+void nano::store::lmdb::delegator::del (store::write_transaction const & transaction_a, nano::account const & representative_a, nano::account const & account_a)
+{
+	auto status = store.del (transaction_a, tables::delegators, nano::delegator_key{ representative_a, account_a });
+	store.release_assert_success (status);
+}
+
+bool nano::store::lmdb::delegator::exists (store::transaction const & transaction_a, nano::account const & representative_a, nano::account const & account_a) const
+{
+	return store.exists (transaction_a, tables::delegators, nano::delegator_key{ representative_a, account_a });
+}
+
+uint64_t nano::store::lmdb::delegator::count (store::transaction const & transaction_a) const
+{
+	return store.count (transaction_a, tables::delegators);
+}
+
+void nano::store::lmdb::delegator::clear (store::write_transaction const & transaction_a)
+{
+	auto status = store.drop (transaction_a, tables::delegators);
+	store.release_assert_success (status);
+}
+
+auto nano::store::lmdb::delegator::begin (store::transaction const & transaction_a, nano::delegator_key const & key_a) const -> iterator
+{
+	lmdb::db_val val{ key_a };
+	return iterator{ store::iterator{ lmdb::iterator::lower_bound (store.env.tx (transaction_a), delegators_handle, val) } };
+}
+
+auto nano::store::lmdb::delegator::begin (store::transaction const & transaction_a) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::begin (store.env.tx (transaction_a), delegators_handle) } };
+}
+
+auto nano::store::lmdb::delegator::end (store::transaction const & transaction_a) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::end (store.env.tx (transaction_a), delegators_handle) } };
+}
+
+void nano::store::lmdb::delegator::for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, { start, 0 }), !is_last ? this->begin (transaction, { end, 0 }) : this->end (transaction));
+	});
+}
@@ -0,0 +1,67 @@
+#include <nano/secure/height_key.hpp>
+#include <nano/secure/parallel_traversal.hpp>
+#include <nano/store/lmdb/height.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+
+nano::store::lmdb::height::height (nano::store::lmdb::component & store_a) :
+	store{ store_a } {};
+
+void nano::store::lmdb::height::put (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a, nano::block_hash const & hash_a)
+{
+	auto status = store.put (transaction_a, tables::heights, nano::height_key{ account_a, height_a }, hash_a);
+	store.release_assert_success (status);
+}
+
+void nano::store::lmdb::height::del (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a)
+{
+	auto status = store.del (transaction_a, tables::heights, nano::height_key{ account_a, height_a });
+	store.release_assert_success (status);
+}
+
+std::optional<nano::block_hash> nano::store::lmdb::height::get (store::transaction const & transaction_a, nano::account const & account_a, uint64_t height_a) const
+{
+	nano::store::lmdb::db_val value;
+	auto status = store.get (transaction_a, tables::heights, nano::height_key{ account_a, height_a }, value);
+	release_assert (store.success (status) || store.not_found (status));
+	if (!store.success (status))
+	{
+		return std::nullopt;
+	}
+	return static_cast<nano::block_hash> (value);
+}
+
+uint64_t nano::store::lmdb::height::count (store::transaction const & transaction_a) const
+{
+	return store.count (transaction_a, tables::heights);
+}
+
+void nano::store::lmdb::height::clear (store::write_transaction const & transaction_a)
+{
+	auto status = store.drop (transaction_a, tables::heights);
+	store.release_assert_success (status);
+}
+
+auto nano::store::lmdb::height::begin (store::transaction const & transaction_a, nano::height_key const & key_a) const -> iterator
+{
+	lmdb::db_val val{ key_a };
+	return iterator{ store::iterator{ lmdb::iterator::lower_bound (store.env.tx (transaction_a), heights_handle, val) } };
+}
+
+auto nano::store::lmdb::height::begin (store::transaction const & transaction_a) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::begin (store.env.tx (transaction_a), heights_handle) } };
+}
+
+auto nano::store::lmdb::height::end (store::transaction const & transaction_a) const -> iterator
+{
+	return iterator{ store::iterator{ lmdb::iterator::end (store.env.tx (transaction_a), heights_handle) } };
+}
+
+void nano::store::lmdb::height::for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const
+{
+	parallel_traversal<nano::uint256_t> (
+	[&action_a, this] (nano::uint256_t const & start, nano::uint256_t const & end, bool const is_last) {
+		auto transaction (this->store.tx_begin_read ());
+		action_a (transaction, this->begin (transaction, { start, 0 }), !is_last ? this->begin (transaction, { end, 0 }) : this->end (transaction));
+	});
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <nano/store/height.hpp>
+
+#include <lmdb/libraries/liblmdb/lmdb.h>
+
+namespace nano::store::lmdb
+{
+class component;
+}
+namespace nano::store::lmdb
+{
+class height : public nano::store::height
+{
+private:
+	nano::store::lmdb::component & store;
+
+public:
+	explicit height (nano::store::lmdb::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a, nano::block_hash const & hash_a) override;
+	void del (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a) override;
+	std::optional<nano::block_hash> get (store::transaction const & transaction_a, nano::account const & account_a, uint64_t height_a) const override;
+	uint64_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	iterator begin (store::transaction const & transaction_a, nano::height_key const & key_a) const override;
+	iterator begin (store::transaction const & transaction_a) const override;
+	iterator end (store::transaction const & transaction_a) const override;
+	void for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const override;
+
+	/**
+	 * Maps positions in account chains to block hashes
+	 * nano::height_key -> nano::block_hash
+	 */
+	MDB_dbi heights_handle{ 0 };
+};
+} // namespace nano::store::lmdb
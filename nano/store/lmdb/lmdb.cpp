@@ -7,12 +7,14 @@
 #include <nano/store/lmdb/lmdb.hpp>
 #include <nano/store/lmdb/wallet_value.hpp>
 #include <nano/store/typed_iterator_templ.hpp>
+#include <nano/store/upgrade.hpp>
 #include <nano/store/version.hpp>
 #include <nano/store/versioning.hpp>
 
 #include <boost/format.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <numeric>
 #include <queue>
 
 template class nano::store::typed_iterator<nano::account, nano::account_info_v22>;
@@ -29,7 +31,9 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 		confirmation_height_store,
 		final_vote_store,
 		version_store,
-		rep_weight_store
+		rep_weight_store,
+		delegator_store,
+		height_store
 	},
 	// clang-format on
 	block_store{ *this },
@@ -42,6 +46,8 @@ nano::store::lmdb::component::component (nano::logger & logger_a, std::filesyste
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	delegator_store{ *this },
+	height_store{ *this },
 	logger{ logger_a },
 	env (error, path_a, nano::store::lmdb::env::options::make ().set_config (lmdb_config_a).set_use_no_mem_init (true)),
 	mdb_txn_tracker (logger_a, txn_tracking_config_a, block_processor_batch_max_time_a),
@@ -207,6 +213,9 @@ void nano::store::lmdb::component::open_databases (bool & error_a, store::transa
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "final_votes", flags, &final_vote_store.final_votes_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "blocks", MDB_CREATE, &block_store.blocks_handle) != 0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "rep_weights", flags, &rep_weight_store.rep_weights_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "delegators", flags, &delegator_store.delegators_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "successors", flags, &block_store.successors_handle) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "heights", flags, &height_store.heights_handle) != 0;
 }
 
 bool nano::store::lmdb::component::do_upgrades (store::write_transaction & transaction, nano::ledger_constants & constants, bool & needs_vacuuming)
@@ -230,6 +239,15 @@ bool nano::store::lmdb::component::do_upgrades (store::write_transaction & trans
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
+			upgrade_v25_to_v26 (transaction);
+			[[fallthrough]];
+		case 26:
+			upgrade_v26_to_v27 (transaction);
+			[[fallthrough]];
+		case 27:
 			break;
 		default:
 			logger.critical (nano::log::type::lmdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -321,6 +339,71 @@ void nano::store::lmdb::component::upgrade_v23_to_v24 (store::write_transaction
 	logger.info (nano::log::type::lmdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Fill delegators table from the representative of every existing account
+void nano::store::lmdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25...");
+
+	drop (transaction, tables::delegators);
+	transaction.refresh ();
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::lmdb, "accounts", transaction, account.begin (read_transaction), account.end (read_transaction), [this, &transaction] (auto const & entry) {
+			delegator.put (transaction, entry.second.representative, entry.first);
+		});
+	}
+
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::lmdb, "Upgrading database from v24 to v25 completed");
+}
+
+// Move successors out of the block sidebands into the successors table
+// Embedded successor fields are left as they are, they are ignored from now on
+void nano::store::lmdb::component::upgrade_v25_to_v26 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::lmdb, "Upgrading database from v25 to v26...");
+
+	drop (transaction, tables::successors);
+	transaction.refresh ();
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::lmdb, "blocks", transaction, block.begin (read_transaction), block.end (read_transaction), [this, &transaction] (auto const & entry) {
+			auto const & successor = entry.second.sideband.successor;
+			if (!successor.is_zero ())
+			{
+				block.successor_put (transaction, entry.first, successor);
+			}
+		});
+	}
+
+	version.put (transaction, 26);
+
+	logger.info (nano::log::type::lmdb, "Upgrading database from v25 to v26 completed");
+}
+
+// Fill heights table from the sideband of every existing block
+void nano::store::lmdb::component::upgrade_v26_to_v27 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::lmdb, "Upgrading database from v26 to v27...");
+
+	drop (transaction, tables::heights);
+	transaction.refresh ();
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::lmdb, "blocks", transaction, block.begin (read_transaction), block.end (read_transaction), [this, &transaction] (auto const & entry) {
+			height.put (transaction, entry.second.block->account (), entry.second.sideband.height, entry.first);
+		});
+	}
+
+	version.put (transaction, 27);
+
+	logger.info (nano::log::type::lmdb, "Upgrading database from v26 to v27 completed");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void nano::store::lmdb::component::create_backup_file (nano::store::lmdb::env & env_a, std::filesystem::path const & filepath_a, nano::logger & logger)
 {
@@ -361,6 +444,34 @@ int nano::store::lmdb::component::get (store::transaction const & transaction_a,
 	return mdb_get (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a);
 }
 
+std::vector<int> nano::store::lmdb::component::get_multi (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::lmdb::db_val> const & keys_a, std::vector<nano::store::lmdb::db_val> & values_a) const
+{
+	auto tx = env.tx (transaction_a);
+	auto dbi = table_to_dbi (table_a);
+	// Visiting keys in order lets the cursor skip the tree descent when the next key lives on the current leaf page
+	std::vector<std::size_t> order (keys_a.size ());
+	std::iota (order.begin (), order.end (), 0);
+	std::sort (order.begin (), order.end (), [&] (std::size_t lhs, std::size_t rhs) {
+		return mdb_cmp (tx, dbi, keys_a[lhs], keys_a[rhs]) < 0;
+	});
+	values_a.assign (keys_a.size (), nano::store::lmdb::db_val{});
+	std::vector<int> result (keys_a.size (), MDB_NOTFOUND);
+	if (keys_a.empty ())
+	{
+		return result;
+	}
+	MDB_cursor * cursor;
+	auto status = mdb_cursor_open (tx, dbi, &cursor);
+	release_assert (status == MDB_SUCCESS);
+	for (auto index : order)
+	{
+		MDB_val key = keys_a[index];
+		result[index] = mdb_cursor_get (cursor, &key, values_a[index], MDB_SET_KEY);
+	}
+	mdb_cursor_close (cursor);
+	return result;
+}
+
 int nano::store::lmdb::component::put (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val const & value_a) const
 {
 	return (mdb_put (env.tx (transaction_a), table_to_dbi (table_a), key_a, value_a, 0));
@@ -371,6 +482,16 @@ int nano::store::lmdb::component::del (store::write_transaction const & transact
 	return (mdb_del (env.tx (transaction_a), table_to_dbi (table_a), key_a, nullptr));
 }
 
+nano::store::iterator nano::store::lmdb::component::table_lower_bound (store::transaction const & transaction_a, tables table_a, MDB_val const & key_a) const
+{
+	return store::iterator{ lmdb::iterator::lower_bound (env.tx (transaction_a), table_to_dbi (table_a), key_a) };
+}
+
+nano::store::iterator nano::store::lmdb::component::table_end (store::transaction const & transaction_a, tables table_a) const
+{
+	return store::iterator{ lmdb::iterator::end (env.tx (transaction_a), table_to_dbi (table_a)) };
+}
+
 int nano::store::lmdb::component::drop (store::write_transaction const & transaction_a, tables table_a)
 {
 	return clear (transaction_a, table_to_dbi (table_a));
@@ -418,6 +539,12 @@ MDB_dbi nano::store::lmdb::component::table_to_dbi (tables table_a) const
 			return final_vote_store.final_votes_handle;
 		case tables::rep_weights:
 			return rep_weight_store.rep_weights_handle;
+		case tables::delegators:
+			return delegator_store.delegators_handle;
+		case tables::successors:
+			return block_store.successors_handle;
+		case tables::heights:
+			return height_store.heights_handle;
 		default:
 			release_assert (false);
 			return peer_store.peers_handle;
@@ -10,7 +10,9 @@
 #include <nano/store/lmdb/block.hpp>
 #include <nano/store/lmdb/confirmation_height.hpp>
 #include <nano/store/lmdb/db_val.hpp>
+#include <nano/store/lmdb/delegator.hpp>
 #include <nano/store/lmdb/final_vote.hpp>
+#include <nano/store/lmdb/height.hpp>
 #include <nano/store/lmdb/iterator.hpp>
 #include <nano/store/lmdb/lmdb_env.hpp>
 #include <nano/store/lmdb/online_weight.hpp>
@@ -50,6 +52,8 @@ private:
 	nano::store::lmdb::pruned pruned_store;
 	nano::store::lmdb::version version_store;
 	nano::store::lmdb::rep_weight rep_weight_store;
+	nano::store::lmdb::delegator delegator_store;
+	nano::store::lmdb::height height_store;
 
 	friend class nano::store::lmdb::account;
 	friend class nano::store::lmdb::block;
@@ -61,6 +65,8 @@ private:
 	friend class nano::store::lmdb::pruned;
 	friend class nano::store::lmdb::version;
 	friend class nano::store::lmdb::rep_weight;
+	friend class nano::store::lmdb::delegator;
+	friend class nano::store::lmdb::height;
 
 public:
 	component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::txn_tracking_config const & txn_tracking_config_a = nano::txn_tracking_config{}, std::chrono::milliseconds block_processor_batch_max_time_a = std::chrono::milliseconds (5000), nano::lmdb_config const & lmdb_config_a = nano::lmdb_config{}, bool backup_before_upgrade = false);
@@ -87,9 +93,15 @@ public:
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a) const;
 
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val & value_a) const;
+	/** Looks up all keys with a single cursor, returns a status for each key */
+	std::vector<int> get_multi (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::lmdb::db_val> const & keys_a, std::vector<nano::store::lmdb::db_val> & values_a) const;
 	int put (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a, nano::store::lmdb::db_val const & value_a) const;
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::lmdb::db_val const & key_a) const;
 
+	/** Iterates the raw entries of `table_a` in key order, starting at the first key not less than `key_a` */
+	store::iterator table_lower_bound (store::transaction const & transaction_a, tables table_a, MDB_val const & key_a) const;
+	store::iterator table_end (store::transaction const & transaction_a, tables table_a) const;
+
 	bool copy_db (std::filesystem::path const & destination_file) override;
 	void rebuild_db (store::write_transaction const & transaction_a) override;
 
@@ -103,6 +115,9 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
+	void upgrade_v25_to_v26 (store::write_transaction &);
+	void upgrade_v26_to_v27 (store::write_transaction &);
 
 	void open_databases (bool &, store::transaction const &, unsigned);
 
@@ -33,6 +33,26 @@ std::optional<nano::pending_info> nano::store::lmdb::pending::get (store::transa
 	return result;
 }
 
+std::vector<std::optional<nano::pending_info>> nano::store::lmdb::pending::get_multi (store::transaction const & transaction, std::vector<nano::pending_key> const & keys)
+{
+	std::vector<nano::store::lmdb::db_val> keys_l (keys.begin (), keys.end ());
+	std::vector<nano::store::lmdb::db_val> values;
+	auto const statuses = store.get_multi (transaction, tables::pending, keys_l, values);
+	std::vector<std::optional<nano::pending_info>> result (keys.size ());
+	for (std::size_t i = 0; i < keys.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			nano::bufferstream stream (reinterpret_cast<uint8_t const *> (values[i].data ()), values[i].size ());
+			result[i] = nano::pending_info{};
+			auto error = result[i].value ().deserialize (stream);
+			release_assert (!error);
+		}
+	}
+	return result;
+}
+
 bool nano::store::lmdb::pending::exists (store::transaction const & transaction_a, nano::pending_key const & key_a)
 {
 	auto iterator (begin (transaction_a, key_a));
@@ -97,6 +97,16 @@ void nano::store::lmdb::write_transaction_impl::commit ()
 	}
 }
 
+void nano::store::lmdb::write_transaction_impl::abort ()
+{
+	if (active)
+	{
+		mdb_txn_abort (handle);
+		txn_callbacks.txn_end (this);
+		active = false;
+	}
+}
+
 void nano::store::lmdb::write_transaction_impl::renew ()
 {
 	auto status (mdb_txn_begin (env, nullptr, 0, &handle));
@@ -44,6 +44,7 @@ public:
 	write_transaction_impl (nano::store::lmdb::env const &, txn_callbacks mdb_txn_callbacks);
 	~write_transaction_impl ();
 	void commit () override;
+	void abort () override;
 	void renew () override;
 	void * get_handle () const override;
 	bool contains (nano::tables table_a) const override;
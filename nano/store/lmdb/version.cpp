@@ -26,3 +26,36 @@ int nano::store::lmdb::version::get (store::transaction const & transaction_a) c
 	}
 	return result;
 }
+
+namespace
+{
+nano::uint256_union const cache_snapshot_key{ 2 };
+}
+
+void nano::store::lmdb::version::cache_snapshot_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & snapshot_a)
+{
+	nano::store::lmdb::db_val value{ snapshot_a.size (), const_cast<uint8_t *> (snapshot_a.data ()) };
+	auto status = store.put (transaction_a, tables::meta, cache_snapshot_key, value);
+	store.release_assert_success (status);
+}
+
+std::optional<std::vector<uint8_t>> nano::store::lmdb::version::cache_snapshot_get (store::transaction const & transaction_a) const
+{
+	nano::store::lmdb::db_val data;
+	auto status = store.get (transaction_a, tables::meta, cache_snapshot_key, data);
+	if (store.success (status))
+	{
+		auto begin = reinterpret_cast<uint8_t const *> (data.data ());
+		return std::vector<uint8_t> (begin, begin + data.size ());
+	}
+	return std::nullopt;
+}
+
+void nano::store::lmdb::version::cache_snapshot_del (store::write_transaction const & transaction_a)
+{
+	if (store.exists (transaction_a, tables::meta, cache_snapshot_key))
+	{
+		auto status = store.del (transaction_a, tables::meta, cache_snapshot_key);
+		store.release_assert_success (status);
+	}
+}
@@ -15,6 +15,9 @@ public:
 	explicit version (nano::store::lmdb::component & store_a);
 	void put (store::write_transaction const & transaction_a, int version_a) override;
 	int get (store::transaction const & transaction_a) const override;
+	void cache_snapshot_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & snapshot_a) override;
+	std::optional<std::vector<uint8_t>> cache_snapshot_get (store::transaction const & transaction_a) const override;
+	void cache_snapshot_del (store::write_transaction const & transaction_a) override;
 
 	/**
 	 * Meta information about block store, such as versions.
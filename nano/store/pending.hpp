@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -27,6 +28,8 @@ public:
 	virtual void put (store::write_transaction const &, nano::pending_key const &, nano::pending_info const &) = 0;
 	virtual void del (store::write_transaction const &, nano::pending_key const &) = 0;
 	virtual std::optional<nano::pending_info> get (store::transaction const &, nano::pending_key const &) = 0;
+	/** Batched `get`, result entries are in the same order as the keys */
+	virtual std::vector<std::optional<nano::pending_info>> get_multi (store::transaction const &, std::vector<nano::pending_key> const &) = 0;
 	virtual bool exists (store::transaction const &, nano::pending_key const &) = 0;
 	virtual bool any (store::transaction const &, nano::account const &) = 0;
 	virtual iterator begin (store::transaction const &, nano::pending_key const &) const = 0;
@@ -26,6 +26,26 @@ bool nano::store::rocksdb::account::get (store::transaction const & transaction,
 	return result;
 }
 
+std::vector<std::optional<nano::account_info>> nano::store::rocksdb::account::get_multi (store::transaction const & transaction, std::vector<nano::account> const & accounts)
+{
+	std::vector<nano::store::rocksdb::db_val> keys (accounts.begin (), accounts.end ());
+	std::vector<nano::store::rocksdb::db_val> values;
+	auto const statuses = store.get_multi (transaction, tables::accounts, keys, values);
+	std::vector<std::optional<nano::account_info>> result (accounts.size ());
+	for (std::size_t i = 0; i < accounts.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			nano::bufferstream stream (reinterpret_cast<uint8_t const *> (values[i].data ()), values[i].size ());
+			result[i] = nano::account_info{};
+			auto error = result[i].value ().deserialize (stream);
+			release_assert (!error);
+		}
+	}
+	return result;
+}
+
 void nano::store::rocksdb::account::del (store::write_transaction const & transaction_a, nano::account const & account_a)
 {
 	auto status = store.del (transaction_a, tables::accounts, account_a);
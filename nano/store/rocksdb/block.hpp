@@ -3,10 +3,6 @@
 #include <nano/store/block.hpp>
 #include <nano/store/rocksdb/db_val.hpp>
 
-namespace nano
-{
-class block_predecessor_rocksdb_set;
-}
 namespace nano::store::rocksdb
 {
 class component;
@@ -15,7 +11,6 @@ namespace nano::store::rocksdb
 {
 class block : public nano::store::block
 {
-	friend class nano::block_predecessor_rocksdb_set;
 	nano::store::rocksdb::component & store;
 
 public:
@@ -23,8 +18,10 @@ public:
 	void put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block const & block_a) override;
 	void raw_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & data, nano::block_hash const & hash_a) override;
 	std::optional<nano::block_hash> successor (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	void successor_put (store::write_transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash const & successor_a) override;
 	void successor_clear (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	std::shared_ptr<nano::block> get (store::transaction const & transaction_a, nano::block_hash const & hash_a) const override;
+	std::vector<std::shared_ptr<nano::block>> get_multi (store::transaction const & transaction_a, std::vector<nano::block_hash> const & hashes_a) const override;
 	std::shared_ptr<nano::block> random (store::transaction const & transaction_a) override;
 	void del (store::write_transaction const & transaction_a, nano::block_hash const & hash_a) override;
 	bool exists (store::transaction const & transaction_a, nano::block_hash const & hash_a) override;
@@ -36,7 +33,5 @@ public:
 
 protected:
 	void block_raw_get (store::transaction const & transaction_a, nano::block_hash const & hash_a, nano::store::rocksdb::db_val & value) const;
-	size_t block_successor_offset (store::transaction const & transaction_a, size_t entry_size_a, nano::block_type type_a) const;
-	static nano::block_type block_type_from_raw (void * data_a);
 };
 } // namespace nano::store::rocksdb
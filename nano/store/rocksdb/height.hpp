@@ -0,0 +1,28 @@
+#pragma once
+
+#include <nano/store/height.hpp>
+
+namespace nano::store::rocksdb
+{
+class component;
+}
+namespace nano::store::rocksdb
+{
+class height : public nano::store::height
+{
+private:
+	nano::store::rocksdb::component & store;
+
+public:
+	explicit height (nano::store::rocksdb::component & store_a);
+	void put (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a, nano::block_hash const & hash_a) override;
+	void del (store::write_transaction const & transaction_a, nano::account const & account_a, uint64_t height_a) override;
+	std::optional<nano::block_hash> get (store::transaction const & transaction_a, nano::account const & account_a, uint64_t height_a) const override;
+	uint64_t count (store::transaction const & transaction_a) const override;
+	void clear (store::write_transaction const & transaction_a) override;
+	iterator begin (store::transaction const & transaction_a, nano::height_key const & key_a) const override;
+	iterator begin (store::transaction const & transaction_a) const override;
+	iterator end (store::transaction const & transaction_a) const override;
+	void for_each_par (std::function<void (store::read_transaction const &, iterator, iterator)> const & action_a) const override;
+};
+} // namespace nano::store::rocksdb
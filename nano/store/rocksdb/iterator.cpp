@@ -55,7 +55,14 @@ auto iterator::lower_bound (::rocksdb::DB * db, std::variant<::rocksdb::Transact
 	return iterator{ std::move (iter) };
 }
 
-auto iterator::make_iterator (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table) -> std::unique_ptr<::rocksdb::Iterator>
+auto iterator::prefix_lower_bound (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table, ::rocksdb::Slice const & lower_bound) -> iterator
+{
+	auto iter = make_iterator (db, snapshot, table, true);
+	iter->Seek (lower_bound);
+	return iterator{ std::move (iter) };
+}
+
+auto iterator::make_iterator (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table, bool prefix) -> std::unique_ptr<::rocksdb::Iterator>
 {
 	return std::unique_ptr<::rocksdb::Iterator>{ std::visit ([&] (auto && ptr) {
 		using V = std::remove_cvref_t<decltype (ptr)>;
@@ -63,12 +70,18 @@ auto iterator::make_iterator (::rocksdb::DB * db, std::variant<::rocksdb::Transa
 		{
 			::rocksdb::ReadOptions ropts;
 			ropts.fill_cache = false;
+			// Iteration crosses key prefixes, which is undefined for tables with a prefix extractor unless total order is requested
+			ropts.total_order_seek = !prefix;
+			ropts.prefix_same_as_start = prefix;
 			return ptr->GetIterator (ropts, table);
 		}
 		else if constexpr (std::is_same_v<V, ::rocksdb::ReadOptions *>)
 		{
 			ptr->fill_cache = false;
-			return db->NewIterator (*ptr, table);
+			::rocksdb::ReadOptions ropts = *ptr;
+			ropts.total_order_seek = !prefix;
+			ropts.prefix_same_as_start = prefix;
+			return db->NewIterator (ropts, table);
 		}
 		else
 		{
@@ -29,7 +29,7 @@ class iterator
 	std::variant<std::monostate, std::pair<::rocksdb::Slice, ::rocksdb::Slice>> current;
 	void update ();
 	iterator (decltype (iter) && iter);
-	static auto make_iterator (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table) -> std::unique_ptr<::rocksdb::Iterator>;
+	static auto make_iterator (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table, bool prefix = false) -> std::unique_ptr<::rocksdb::Iterator>;
 
 public:
 	using iterator_category = std::bidirectional_iterator_tag;
@@ -42,6 +42,11 @@ public:
 	static auto begin (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table) -> iterator;
 	static auto end (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table) -> iterator;
 	static auto lower_bound (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table, ::rocksdb::Slice const & lower_bound) -> iterator;
+	/**
+	 * Iterates only keys sharing the prefix of `lower_bound`, as defined by the prefix extractor of the table, which lets prefix Bloom filters skip files.
+	 * Tables without a prefix extractor iterate in total order, callers must still check the prefix of returned keys.
+	 */
+	static auto prefix_lower_bound (::rocksdb::DB * db, std::variant<::rocksdb::Transaction *, ::rocksdb::ReadOptions *> snapshot, ::rocksdb::ColumnFamilyHandle * table, ::rocksdb::Slice const & lower_bound) -> iterator;
 
 	iterator (iterator const &) = delete;
 	auto operator= (iterator const &) -> iterator & = delete;
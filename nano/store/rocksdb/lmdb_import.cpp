@@ -0,0 +1,182 @@
+#include <nano/lib/thread_roles.hpp>
+#include <nano/lib/threading.hpp>
+#include <nano/store/lmdb/lmdb.hpp>
+#include <nano/store/rocksdb/lmdb_import.hpp>
+#include <nano/store/rocksdb/rocksdb.hpp>
+
+#include <thread>
+
+nano::store::rocksdb::lmdb_import::lmdb_import (nano::store::lmdb::component const & source_a, nano::store::rocksdb::component & target_a, std::filesystem::path const & working_path_a, nano::logger & logger_a) :
+	source{ source_a },
+	target{ target_a },
+	working_path{ working_path_a },
+	logger{ logger_a }
+{
+}
+
+bool nano::store::rocksdb::lmdb_import::run ()
+{
+	std::error_code ec;
+	std::filesystem::create_directories (working_path, ec);
+	if (ec)
+	{
+		logger.error (nano::log::type::rocksdb, "Could not create migration directory '{}': {}", working_path.string (), ec.message ());
+		return true;
+	}
+
+	load_checkpoint ();
+	checkpoint.open (working_path / "checkpoint", std::ios::app);
+	if (!checkpoint)
+	{
+		logger.error (nano::log::type::rocksdb, "Could not open migration checkpoint in '{}'", working_path.string ());
+		return true;
+	}
+
+	auto const ranges = pending_ranges ();
+	if (!completed.empty ())
+	{
+		logger.info (nano::log::type::rocksdb, "Resuming migration, {} of {} ranges were already imported", completed.size (), completed.size () + ranges.size ());
+	}
+
+	uint64_t total = 0;
+	{
+		nano::store::component const & source_l = source;
+		auto transaction = source_l.tx_begin_read ();
+		for (auto table : imported_tables ())
+		{
+			total += source_l.count (transaction, table);
+		}
+	}
+	logger.info (nano::log::type::rocksdb, "Importing {} ranges of up to {} entries", ranges.size (), total);
+
+	// Ranges are independent of each other, reading LMDB and writing SST files scales with the number of cores
+	std::atomic<std::size_t> next{ 0 };
+	std::atomic<std::size_t> done{ 0 };
+	auto const thread_count = std::max (1u, std::min (nano::hardware_concurrency (), static_cast<unsigned> (ranges.size ())));
+	std::vector<std::thread> threads;
+	threads.reserve (thread_count);
+	for (unsigned i = 0; i < thread_count; ++i)
+	{
+		threads.emplace_back ([&] () {
+			nano::thread_role::set (nano::thread_role::name::db_parallel_traversal);
+			for (auto index = next++; index < ranges.size () && !error; index = next++)
+			{
+				if (import (ranges[index]))
+				{
+					error = true;
+					break;
+				}
+				record_checkpoint (ranges[index]);
+				if (auto done_l = ++done; done_l % 64 == 0 || done_l == ranges.size ())
+				{
+					logger.info (nano::log::type::rocksdb, "{} of {} ranges imported, {} entries ({}%)", done_l, ranges.size (), entries.load (), total > 0 ? std::min<uint64_t> (entries.load () * 100 / total, 100) : 100);
+				}
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+
+	checkpoint.close ();
+	if (!error)
+	{
+		std::filesystem::remove_all (working_path, ec);
+	}
+	return error;
+}
+
+bool nano::store::rocksdb::lmdb_import::import (range const & range_a)
+{
+	auto const file = working_path / (std::to_string (static_cast<unsigned> (range_a.table)) + "_" + std::to_string (range_a.index) + ".sst");
+	auto writer = target.make_sst_writer (range_a.table);
+	auto status = writer->Open (file.string ());
+	if (!status.ok ())
+	{
+		logger.error (nano::log::type::rocksdb, "Could not create SST file '{}': {}", file.string (), status.ToString ());
+		return true;
+	}
+
+	// A single byte key sorts before every longer key starting with the same byte, ranges therefore cover all keys by their first byte
+	uint64_t count = 0;
+	{
+		auto transaction = source.tx_begin_read ();
+		uint8_t start = static_cast<uint8_t> (range_a.index);
+		uint8_t end = static_cast<uint8_t> (range_a.index + 1);
+		MDB_val start_key{ sizeof (start), &start };
+		MDB_val end_key{ sizeof (end), &end };
+		auto i = source.table_lower_bound (transaction, range_a.table, start_key);
+		auto n = range_a.index + 1 < ranges_per_table ? source.table_lower_bound (transaction, range_a.table, end_key) : source.table_end (transaction, range_a.table);
+		for (; i != n && status.ok (); ++i)
+		{
+			auto const & [key, value] = *i;
+			status = writer->Put (::rocksdb::Slice{ reinterpret_cast<char const *> (key.data ()), key.size () }, ::rocksdb::Slice{ reinterpret_cast<char const *> (value.data ()), value.size () });
+			++count;
+		}
+	}
+	if (!status.ok ())
+	{
+		logger.error (nano::log::type::rocksdb, "Could not write SST file '{}': {}", file.string (), status.ToString ());
+		return true;
+	}
+	if (count == 0)
+	{
+		// Empty SST files cannot be finished nor ingested
+		writer.reset ();
+		std::error_code ec;
+		std::filesystem::remove (file, ec);
+		return false;
+	}
+	status = writer->Finish ();
+	if (!status.ok ())
+	{
+		logger.error (nano::log::type::rocksdb, "Could not finish SST file '{}': {}", file.string (), status.ToString ());
+		return true;
+	}
+	if (target.ingest (range_a.table, { file.string () }))
+	{
+		return true;
+	}
+	entries += count;
+	return false;
+}
+
+void nano::store::rocksdb::lmdb_import::load_checkpoint ()
+{
+	std::ifstream stream{ working_path / "checkpoint" };
+	unsigned table;
+	unsigned index;
+	while (stream >> table >> index)
+	{
+		completed.emplace (static_cast<nano::tables> (table), index);
+	}
+}
+
+void nano::store::rocksdb::lmdb_import::record_checkpoint (range const & range_a)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	// Flushed right away, a range missing from the checkpoint is imported again which is harmless as ingestion overwrites identical entries
+	checkpoint << static_cast<unsigned> (range_a.table) << ' ' << range_a.index << std::endl;
+}
+
+auto nano::store::rocksdb::lmdb_import::pending_ranges () const -> std::vector<range>
+{
+	std::vector<range> result;
+	for (auto table : imported_tables ())
+	{
+		for (unsigned index = 0; index < ranges_per_table; ++index)
+		{
+			if (!completed.contains ({ table, index }))
+			{
+				result.push_back ({ table, index });
+			}
+		}
+	}
+	return result;
+}
+
+std::vector<nano::tables> nano::store::rocksdb::lmdb_import::imported_tables ()
+{
+	return { tables::accounts, tables::blocks, tables::confirmation_height, tables::delegators, tables::final_votes, tables::heights, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::rep_weights, tables::successors };
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/logging.hpp>
+#include <nano/store/tables.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace nano::store::lmdb
+{
+class component;
+}
+
+namespace nano::store::rocksdb
+{
+class component;
+
+/**
+ * Copies every table of an LMDB ledger into a RocksDB ledger
+ * Tables are split into key ranges by their first byte. Ranges are read in parallel, written to sorted SST files and ingested into RocksDB,
+ * entries are copied verbatim as both backends share the same key and value layout.
+ * Ingested ranges are recorded in a checkpoint file inside the working directory, running the import again after an interruption skips them.
+ */
+class lmdb_import final
+{
+public:
+	lmdb_import (nano::store::lmdb::component const & source, nano::store::rocksdb::component & target, std::filesystem::path const & working_path, nano::logger &);
+
+	/** Returns true on error. The working directory is removed once every range is imported */
+	bool run ();
+
+	static std::size_t constexpr ranges_per_table = 256;
+
+private:
+	class range final
+	{
+	public:
+		nano::tables table;
+		unsigned index;
+	};
+
+	/** Copies a single range, returns true on error */
+	bool import (range const &);
+	void load_checkpoint ();
+	void record_checkpoint (range const &);
+
+	std::vector<range> pending_ranges () const;
+	static std::vector<nano::tables> imported_tables ();
+
+private:
+	nano::store::lmdb::component const & source;
+	nano::store::rocksdb::component & target;
+	std::filesystem::path const working_path;
+	nano::logger & logger;
+
+	std::set<std::pair<nano::tables, unsigned>> completed;
+	std::ofstream checkpoint;
+	nano::mutex mutex;
+
+	std::atomic<uint64_t> entries{ 0 };
+	std::atomic<bool> error{ false };
+};
+}
@@ -34,6 +34,26 @@ std::optional<nano::pending_info> nano::store::rocksdb::pending::get (store::tra
 	return result;
 }
 
+std::vector<std::optional<nano::pending_info>> nano::store::rocksdb::pending::get_multi (store::transaction const & transaction, std::vector<nano::pending_key> const & keys)
+{
+	std::vector<nano::store::rocksdb::db_val> keys_l (keys.begin (), keys.end ());
+	std::vector<nano::store::rocksdb::db_val> values;
+	auto const statuses = store.get_multi (transaction, tables::pending, keys_l, values);
+	std::vector<std::optional<nano::pending_info>> result (keys.size ());
+	for (std::size_t i = 0; i < keys.size (); ++i)
+	{
+		release_assert (store.success (statuses[i]) || store.not_found (statuses[i]));
+		if (store.success (statuses[i]))
+		{
+			nano::bufferstream stream (reinterpret_cast<uint8_t const *> (values[i].data ()), values[i].size ());
+			result[i] = nano::pending_info{};
+			auto error = result[i].value ().deserialize (stream);
+			release_assert (!error);
+		}
+	}
+	return result;
+}
+
 bool nano::store::rocksdb::pending::exists (store::transaction const & transaction_a, nano::pending_key const & key_a)
 {
 	auto iterator (begin (transaction_a, key_a));
@@ -42,8 +62,10 @@ bool nano::store::rocksdb::pending::exists (store::transaction const & transacti
 
 bool nano::store::rocksdb::pending::any (store::transaction const & transaction_a, nano::account const & account_a)
 {
-	auto iterator (begin (transaction_a, nano::pending_key (account_a, 0)));
-	return iterator != end (transaction_a) && nano::pending_key (iterator->first).account == account_a;
+	// Restricting the seek to the account prefix lets prefix filters skip files without receivables for the account
+	rocksdb::db_val val{ nano::pending_key (account_a, 0) };
+	auto iterator = rocksdb::iterator::prefix_lower_bound (store.db.get (), rocksdb::tx (transaction_a), store.table_to_column_family (tables::pending), val);
+	return !iterator.is_end () && static_cast<nano::pending_key> (rocksdb::db_val{ iterator->first }).account == account_a;
 }
 
 auto nano::store::rocksdb::pending::begin (store::transaction const & transaction_a, nano::pending_key const & key_a) const -> iterator
@@ -5,6 +5,7 @@
 #include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/store/rocksdb/transaction_impl.hpp>
 #include <nano/store/rocksdb/utility.hpp>
+#include <nano/store/upgrade.hpp>
 #include <nano/store/version.hpp>
 
 #include <boost/format.hpp>
@@ -49,7 +50,9 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 		confirmation_height_store,
 		final_vote_store,
 		version_store,
-		rep_weight_store
+		rep_weight_store,
+		delegator_store,
+		height_store
 	},
 	// clang-format on
 	block_store{ *this },
@@ -62,11 +65,14 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 	final_vote_store{ *this },
 	version_store{ *this },
 	rep_weight_store{ *this },
+	delegator_store{ *this },
+	height_store{ *this },
 	logger{ logger_a },
 	constants{ constants },
 	rocksdb_config{ rocksdb_config_a },
 	max_block_write_batch_num_m{ nano::narrow_cast<unsigned> ((rocksdb_config_a.write_cache * 1024 * 1024) / (2 * (sizeof (nano::block_type) + nano::state_block::size + nano::block_sideband::size (nano::block_type::state)))) },
-	cf_name_table_map{ create_cf_name_table_map () }
+	cf_name_table_map{ create_cf_name_table_map () },
+	block_cache{ ::rocksdb::NewLRUCache (rocksdb_config_a.read_cache * 1024 * 1024 * all_tables ().size ()) }
 {
 	boost::system::error_code error_mkdir, error_chmod;
 	std::filesystem::create_directories (path_a, error_mkdir);
@@ -82,6 +88,11 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 
 	generate_tombstone_map ();
 
+	if (rocksdb_config.compress_blocks && !nano::rocksdb_config::zstd_supported ())
+	{
+		logger.warn (nano::log::type::rocksdb, "Blocks table compression is enabled but this node was built without ZSTD support, blocks are stored uncompressed");
+	}
+
 	// TODO: get_db_options () registers a listener for resetting tombstones, needs to check if it is a problem calling it more than once.
 	auto options = get_db_options ();
 
@@ -168,7 +179,10 @@ std::unordered_map<char const *, nano::tables> nano::store::rocksdb::component::
 		{ "confirmation_height", tables::confirmation_height },
 		{ "pruned", tables::pruned },
 		{ "final_votes", tables::final_votes },
-		{ "rep_weights", tables::rep_weights } };
+		{ "rep_weights", tables::rep_weights },
+		{ "delegators", tables::delegators },
+		{ "successors", tables::successors },
+		{ "heights", tables::heights } };
 
 	debug_assert (map.size () == all_tables ().size () + 1);
 	return map;
@@ -226,6 +240,15 @@ bool nano::store::rocksdb::component::do_upgrades (store::write_transaction & tr
 			upgrade_v23_to_v24 (transaction);
 			[[fallthrough]];
 		case 24:
+			upgrade_v24_to_v25 (transaction);
+			[[fallthrough]];
+		case 25:
+			upgrade_v25_to_v26 (transaction);
+			[[fallthrough]];
+		case 26:
+			upgrade_v26_to_v27 (transaction);
+			[[fallthrough]];
+		case 27:
 			break;
 		default:
 			logger.critical (nano::log::type::rocksdb, "The version of the ledger ({}) is too high for this node", version_l);
@@ -373,11 +396,105 @@ void nano::store::rocksdb::component::upgrade_v23_to_v24 (store::write_transacti
 	logger.info (nano::log::type::rocksdb, "Upgrading database from v23 to v24 completed");
 }
 
+// Drops the column family if it exists and creates it again empty
+void nano::store::rocksdb::component::recreate_column_family (store::write_transaction & transaction, char const * name)
+{
+	if (column_family_exists (name))
+	{
+		logger.info (nano::log::type::rocksdb, "Dropping existing {} table", name);
+		auto const existing_handle = get_column_family (name);
+		db->DropColumnFamily (existing_handle);
+		db->DestroyColumnFamilyHandle (existing_handle);
+		std::erase_if (handles, [existing_handle] (auto & handle) {
+			if (handle.get () == existing_handle)
+			{
+				// The handle resource is deleted by RocksDB.
+				[[maybe_unused]] auto ptr = handle.release ();
+				return true;
+			}
+			return false;
+		});
+		transaction.refresh ();
+	}
+
+	logger.info (nano::log::type::rocksdb, "Creating table {}", name);
+	::rocksdb::ColumnFamilyOptions new_cf_options;
+	::rocksdb::ColumnFamilyHandle * new_cf_handle;
+	::rocksdb::Status status = db->CreateColumnFamily (new_cf_options, name, &new_cf_handle);
+	release_assert (success (status.code ()));
+	handles.emplace_back (new_cf_handle);
+	transaction.refresh ();
+}
+
+// Fill delegators table from the representative of every existing account
+void nano::store::rocksdb::component::upgrade_v24_to_v25 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25...");
+
+	recreate_column_family (transaction, "delegators");
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::rocksdb, "accounts", transaction, account.begin (read_transaction), account.end (read_transaction), [this, &transaction] (auto const & entry) {
+			delegator.put (transaction, entry.second.representative, entry.first);
+		});
+	}
+
+	version.put (transaction, 25);
+
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v24 to v25 completed");
+}
+
+// Move successors out of the block sidebands into the successors table
+// Embedded successor fields are left as they are, they are ignored from now on
+void nano::store::rocksdb::component::upgrade_v25_to_v26 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v25 to v26...");
+
+	recreate_column_family (transaction, "successors");
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::rocksdb, "blocks", transaction, block.begin (read_transaction), block.end (read_transaction), [this, &transaction] (auto const & entry) {
+			auto const & successor = entry.second.sideband.successor;
+			if (!successor.is_zero ())
+			{
+				block.successor_put (transaction, entry.first, successor);
+			}
+		});
+	}
+
+	version.put (transaction, 26);
+
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v25 to v26 completed");
+}
+
+// Fill heights table from the sideband of every existing block
+void nano::store::rocksdb::component::upgrade_v26_to_v27 (store::write_transaction & transaction)
+{
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v26 to v27...");
+
+	recreate_column_family (transaction, "heights");
+
+	{
+		auto read_transaction = tx_begin_read ();
+		nano::store::upgrade_fill (logger, nano::log::type::rocksdb, "blocks", transaction, block.begin (read_transaction), block.end (read_transaction), [this, &transaction] (auto const & entry) {
+			height.put (transaction, entry.second.block->account (), entry.second.sideband.height, entry.first);
+		});
+	}
+
+	version.put (transaction, 27);
+
+	logger.info (nano::log::type::rocksdb, "Upgrading database from v26 to v27 completed");
+}
+
 void nano::store::rocksdb::component::generate_tombstone_map ()
 {
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::blocks), std::forward_as_tuple (0, 25000));
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::accounts), std::forward_as_tuple (0, 25000));
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::pending), std::forward_as_tuple (0, 25000));
+	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::successors), std::forward_as_tuple (0, 25000));
+	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::heights), std::forward_as_tuple (0, 25000));
 }
 
 rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (std::string const & cf_name_a) const
@@ -385,7 +502,40 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 	::rocksdb::ColumnFamilyOptions cf_options;
 	if (cf_name_a != ::rocksdb::kDefaultColumnFamilyName)
 	{
-		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_table_options ()));
+		auto table_options = get_table_options ();
+		if (cf_name_a == "blocks")
+		{
+			// Blocks are written once and read rarely compared to their size, trade cpu for disk space
+			if (rocksdb_config.compress_blocks && nano::rocksdb_config::zstd_supported ())
+			{
+				cf_options.compression = ::rocksdb::kZSTD;
+				// Blocks are small and similar to each other, a shared dictionary makes compression effective
+				cf_options.compression_opts.max_dict_bytes = 16 * 1024;
+				cf_options.compression_opts.zstd_max_train_bytes = 100 * cf_options.compression_opts.max_dict_bytes;
+			}
+		}
+		else if (cf_name_a == "pending")
+		{
+			if (rocksdb_config.pending_prefix_filter)
+			{
+				// Keys start with the 32 byte destination account, filters then also answer whether an account has any receivable
+				cf_options.prefix_extractor.reset (::rocksdb::NewFixedPrefixTransform (sizeof (nano::account)));
+				table_options.whole_key_filtering = true;
+			}
+		}
+		else if (cf_name_a == "accounts" || cf_name_a == "confirmation_height" || cf_name_a == "successors" || cf_name_a == "heights")
+		{
+			if (rocksdb_config.partitioned_filters)
+			{
+				// Large tables serving point lookups, only the top level index stays in memory and partitions are cached on demand
+				table_options.index_type = ::rocksdb::BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+				table_options.partition_filters = true;
+				table_options.cache_index_and_filter_blocks = true;
+				table_options.cache_index_and_filter_blocks_with_high_priority = true;
+				table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+			}
+		}
+		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (table_options));
 		cf_options.table_factory = table_factory;
 		// Size of each memtable (write buffer for this column family)
 		cf_options.write_buffer_size = rocksdb_config.write_cache * 1024 * 1024;
@@ -492,6 +642,12 @@ rocksdb::ColumnFamilyHandle * nano::store::rocksdb::component::table_to_column_f
 			return get_column_family ("final_votes");
 		case tables::rep_weights:
 			return get_column_family ("rep_weights");
+		case tables::delegators:
+			return get_column_family ("delegators");
+		case tables::successors:
+			return get_column_family ("successors");
+		case tables::heights:
+			return get_column_family ("heights");
 		default:
 			release_assert (false);
 			return get_column_family ("");
@@ -548,6 +704,26 @@ void nano::store::rocksdb::component::flush_tombstones_check (tables table_a)
 	}
 }
 
+std::unique_ptr<rocksdb::SstFileWriter> nano::store::rocksdb::component::make_sst_writer (tables table_a) const
+{
+	auto handle = table_to_column_family (table_a);
+	// Files are written with the options of the target table so ingestion does not need to rewrite them
+	::rocksdb::Options options{ ::rocksdb::DBOptions{}, get_cf_options (handle->GetName ()) };
+	return std::make_unique<::rocksdb::SstFileWriter> (::rocksdb::EnvOptions{}, options, handle);
+}
+
+bool nano::store::rocksdb::component::ingest (tables table_a, std::vector<std::string> const & files_a)
+{
+	::rocksdb::IngestExternalFileOptions options;
+	options.move_files = true;
+	auto status = db->IngestExternalFile (table_to_column_family (table_a), files_a, options);
+	if (!status.ok ())
+	{
+		logger.error (nano::log::type::rocksdb, "Failed to ingest files into table {}: {}", table_to_column_family (table_a)->GetName (), status.ToString ());
+	}
+	return !status.ok ();
+}
+
 void nano::store::rocksdb::component::flush_table (nano::tables table_a)
 {
 	db->Flush (::rocksdb::FlushOptions{}, table_to_column_family (table_a));
@@ -585,6 +761,46 @@ int nano::store::rocksdb::component::get (store::transaction const & transaction
 	return status.code ();
 }
 
+std::vector<int> nano::store::rocksdb::component::get_multi (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::rocksdb::db_val> const & keys_a, std::vector<nano::store::rocksdb::db_val> & values_a) const
+{
+	::rocksdb::ReadOptions options;
+	std::vector<::rocksdb::Slice> keys (keys_a.begin (), keys_a.end ());
+	std::vector<::rocksdb::PinnableSlice> values (keys.size ());
+	std::vector<::rocksdb::Status> statuses (keys.size ());
+	auto handle = table_to_column_family (table_a);
+	auto internals = rocksdb::tx (transaction_a);
+	std::visit ([&] (auto && ptr) {
+		using V = std::remove_cvref_t<decltype (ptr)>;
+		if constexpr (std::is_same_v<V, ::rocksdb::Transaction *>)
+		{
+			ptr->MultiGet (options, handle, keys.size (), keys.data (), values.data (), statuses.data ());
+		}
+		else if constexpr (std::is_same_v<V, ::rocksdb::ReadOptions *>)
+		{
+			db->MultiGet (*ptr, handle, keys.size (), keys.data (), values.data (), statuses.data ());
+		}
+		else
+		{
+			static_assert (sizeof (V) == 0, "Missing variant handler for type V");
+		}
+	},
+	internals);
+
+	values_a.assign (keys.size (), nano::store::rocksdb::db_val{});
+	std::vector<int> result;
+	result.reserve (keys.size ());
+	for (std::size_t i = 0; i < keys.size (); ++i)
+	{
+		if (statuses[i].ok ())
+		{
+			values_a[i].buffer = std::make_shared<std::vector<uint8_t>> (values[i].data (), values[i].data () + values[i].size ());
+			values_a[i].convert_buffer_to_value ();
+		}
+		result.push_back (statuses[i].code ());
+	}
+	return result;
+}
+
 int nano::store::rocksdb::component::put (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val const & value_a)
 {
 	debug_assert (transaction_a.contains (table_a));
@@ -666,6 +882,22 @@ uint64_t nano::store::rocksdb::component::count (store::transaction const & tran
 			++sum;
 		}
 	}
+	// delegators has as many entries as accounts, same restrictions apply
+	else if (table_a == tables::delegators)
+	{
+		for (auto i (delegator.begin (transaction_a)), n (delegator.end (transaction_a)); i != n; ++i)
+		{
+			++sum;
+		}
+	}
+	// heights has as many entries as blocks, same restrictions apply
+	else if (table_a == tables::heights)
+	{
+		for (auto i (height.begin (transaction_a)), n (height.end (transaction_a)); i != n; ++i)
+		{
+			++sum;
+		}
+	}
 	else
 	{
 		debug_assert (false);
@@ -755,8 +987,8 @@ rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_optio
 	// Any existing ledger data in version 4 will not be migrated. New data will be written in version 5.
 	table_options.format_version = 5;
 
-	// Block cache for reads
-	table_options.block_cache = ::rocksdb::NewLRUCache (rocksdb_config.read_cache * 1024 * 1024);
+	// Block cache for reads, shared so that busy tables can use the share of idle ones
+	table_options.block_cache = block_cache;
 
 	// Bloom filter to help with point reads. 10bits gives 1% false positive rate.
 	table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (10, false));
@@ -775,7 +1007,7 @@ void nano::store::rocksdb::component::on_flush (::rocksdb::FlushJobInfo const &
 
 std::vector<nano::tables> nano::store::rocksdb::component::all_tables () const
 {
-	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights };
+	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::vote, tables::rep_weights, tables::delegators, tables::successors, tables::heights };
 }
 
 bool nano::store::rocksdb::component::copy_db (std::filesystem::path const & destination_path)
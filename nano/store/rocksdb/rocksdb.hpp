@@ -8,7 +8,9 @@
 #include <nano/store/rocksdb/account.hpp>
 #include <nano/store/rocksdb/block.hpp>
 #include <nano/store/rocksdb/confirmation_height.hpp>
+#include <nano/store/rocksdb/delegator.hpp>
 #include <nano/store/rocksdb/final_vote.hpp>
+#include <nano/store/rocksdb/height.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
 #include <nano/store/rocksdb/online_weight.hpp>
 #include <nano/store/rocksdb/peer.hpp>
@@ -21,6 +23,7 @@
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/sst_file_writer.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction_db.h>
 
@@ -51,6 +54,8 @@ private:
 	nano::store::rocksdb::pruned pruned_store;
 	nano::store::rocksdb::version version_store;
 	nano::store::rocksdb::rep_weight rep_weight_store;
+	nano::store::rocksdb::delegator delegator_store;
+	nano::store::rocksdb::height height_store;
 
 public:
 	friend class nano::store::rocksdb::account;
@@ -63,6 +68,8 @@ public:
 	friend class nano::store::rocksdb::pruned;
 	friend class nano::store::rocksdb::version;
 	friend class nano::store::rocksdb::rep_weight;
+	friend class nano::store::rocksdb::delegator;
+	friend class nano::store::rocksdb::height;
 
 	explicit component (nano::logger &, std::filesystem::path const &, nano::ledger_constants & constants, nano::rocksdb_config const & = nano::rocksdb_config{}, bool open_read_only = false);
 
@@ -75,9 +82,16 @@ public:
 
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a) const;
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const;
+	/** Looks up all keys with a single MultiGet call, returns a status for each key */
+	std::vector<int> get_multi (store::transaction const & transaction_a, tables table_a, std::vector<nano::store::rocksdb::db_val> const & keys_a, std::vector<nano::store::rocksdb::db_val> & values_a) const;
 	int put (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val const & value_a);
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a);
 
+	/** Writer of external SST files using the options of `table_a`, keys must be added in ascending order */
+	std::unique_ptr<::rocksdb::SstFileWriter> make_sst_writer (tables table_a) const;
+	/** Moves finished SST files into `table_a`, bypassing the memtable and write ahead log. Returns true on error */
+	bool ingest (tables table_a, std::vector<std::string> const & files_a);
+
 	void serialize_memory_stats (boost::property_tree::ptree &) override;
 
 	bool copy_db (std::filesystem::path const & destination) override;
@@ -109,6 +123,8 @@ private:
 
 	std::unordered_map<nano::tables, tombstone_info> tombstone_map;
 	std::unordered_map<char const *, nano::tables> cf_name_table_map;
+	/** Read cache shared by all column families */
+	std::shared_ptr<::rocksdb::Cache> block_cache;
 
 	std::vector<nano::tables> all_tables () const;
 
@@ -130,6 +146,7 @@ private:
 	bool column_family_exists (char const * name) const;
 	::rocksdb::ColumnFamilyHandle * table_to_column_family (tables table_a) const;
 	int clear (::rocksdb::ColumnFamilyHandle * column_family);
+	void recreate_column_family (store::write_transaction &, char const * name);
 
 	void open (bool & error_a, std::filesystem::path const & path_a, bool open_read_only_a, ::rocksdb::Options const & options_a, std::vector<::rocksdb::ColumnFamilyDescriptor> column_families);
 
@@ -137,6 +154,9 @@ private:
 	void upgrade_v21_to_v22 (store::write_transaction &);
 	void upgrade_v22_to_v23 (store::write_transaction &);
 	void upgrade_v23_to_v24 (store::write_transaction &);
+	void upgrade_v24_to_v25 (store::write_transaction &);
+	void upgrade_v25_to_v26 (store::write_transaction &);
+	void upgrade_v26_to_v27 (store::write_transaction &);
 
 	::rocksdb::Options get_db_options ();
 	::rocksdb::BlockBasedTableOptions get_table_options () const;
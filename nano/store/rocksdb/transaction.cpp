@@ -57,6 +57,16 @@ void nano::store::rocksdb::write_transaction_impl::commit ()
 	}
 }
 
+void nano::store::rocksdb::write_transaction_impl::abort ()
+{
+	if (active)
+	{
+		auto status = txn->Rollback ();
+		release_assert (status.ok () && "Unable to roll back the RocksDB transaction", status.ToString ());
+		active = false;
+	}
+}
+
 void nano::store::rocksdb::write_transaction_impl::renew ()
 {
 	::rocksdb::TransactionOptions txn_options;
@@ -29,6 +29,7 @@ public:
 	write_transaction_impl (::rocksdb::TransactionDB * db_a);
 	~write_transaction_impl ();
 	void commit () override;
+	void abort () override;
 	void renew () override;
 	void * get_handle () const override;
 	bool contains (nano::tables table_a) const override;
@@ -11,12 +11,15 @@ enum class tables
 	blocks,
 	confirmation_height,
 	default_unused, // RocksDB only
+	delegators,
 	final_votes,
+	heights,
 	meta,
 	online_weight,
 	peers,
 	pending,
 	pruned,
+	successors,
 	vote,
 	rep_weights,
 };
@@ -122,6 +122,12 @@ void nano::store::write_transaction::commit ()
 	impl->commit ();
 }
 
+void nano::store::write_transaction::abort ()
+{
+	++current_epoch;
+	impl->abort ();
+}
+
 void nano::store::write_transaction::renew ()
 {
 	++current_epoch;
@@ -30,6 +30,7 @@ class write_transaction_impl : public transaction_impl
 public:
 	explicit write_transaction_impl (nano::id_dispenser::id_t const store_id = 0);
 	virtual void commit () = 0;
+	virtual void abort () = 0;
 	virtual void renew () = 0;
 	virtual bool contains (nano::tables table_a) const = 0;
 };
@@ -84,6 +85,8 @@ public:
 	nano::id_dispenser::id_t store_id () const override;
 
 	void commit ();
+	/** Discards the changes made since the transaction was started or renewed */
+	void abort ();
 	void renew ();
 	void refresh ();
 	void refresh_if_needed (std::chrono::milliseconds max_age = std::chrono::milliseconds{ 500 });
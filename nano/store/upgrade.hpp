@@ -0,0 +1,37 @@
+#pragma once
+
+#include <nano/lib/logging.hpp>
+#include <nano/store/transaction.hpp>
+
+#include <string_view>
+
+namespace nano::store
+{
+/**
+ * Fills a table during a database upgrade by calling `fill` for every entry in [begin, end)
+ * The write transaction is committed in batches to prevent excessive memory usage
+ * @return number of entries visited
+ */
+template <typename Iterator, typename Fill>
+size_t upgrade_fill (nano::logger & logger, nano::log::type type, std::string_view entries, write_transaction & transaction, Iterator begin, Iterator const & end, Fill const & fill)
+{
+	// TODO: Make this smaller in dev builds
+	size_t const batch_size = 250000;
+
+	size_t processed = 0;
+	for (auto i = std::move (begin); i != end; ++i)
+	{
+		fill (*i);
+
+		processed++;
+		if (processed % batch_size == 0)
+		{
+			logger.info (type, "Processed {} {}", processed, entries);
+			transaction.refresh (); // Refresh to prevent excessive memory usage
+		}
+	}
+
+	logger.info (type, "Done processing {} {}", processed, entries);
+	return processed;
+}
+}
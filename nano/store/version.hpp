@@ -4,6 +4,8 @@
 #include <nano/store/component.hpp>
 
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -12,12 +14,16 @@ class block_hash;
 namespace nano::store
 {
 /**
- * Manages version storage
+ * Manages version storage and other store metadata
  */
 class version
 {
 public:
 	virtual void put (store::write_transaction const &, int) = 0;
 	virtual int get (store::transaction const &) const = 0;
+	/** Serialized ledger cache snapshot, see nano::ledger::cache_snapshot_write */
+	virtual void cache_snapshot_put (store::write_transaction const &, std::vector<uint8_t> const &) = 0;
+	virtual std::optional<std::vector<uint8_t>> cache_snapshot_get (store::transaction const &) const = 0;
+	virtual void cache_snapshot_del (store::write_transaction const &) = 0;
 };
 } // namespace nano::store
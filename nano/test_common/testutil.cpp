@@ -144,8 +144,16 @@ void nano::test::confirm (nano::ledger & ledger, std::shared_ptr<nano::block> co
 
 void nano::test::confirm (nano::ledger & ledger, nano::block_hash const & hash)
 {
-	auto transaction = ledger.tx_begin_write ();
-	ledger.confirm (transaction, hash);
+	// Confirming returns early when the transaction gets old, continue in a new one
+	while (true)
+	{
+		auto transaction = ledger.tx_begin_write ();
+		ledger.confirm (transaction, hash);
+		if (ledger.confirmed.block_exists_or_pruned (transaction, hash))
+		{
+			break;
+		}
+	}
 }
 
 bool nano::test::block_or_pruned_all_exists (nano::node & node, std::vector<nano::block_hash> hashes)